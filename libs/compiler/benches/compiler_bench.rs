@@ -0,0 +1,266 @@
+//! Criterion benches for the compiler's hot paths. Conversion and stitching run against
+//! synthetic inputs so they need no toolchain; the end-to-end `compileSource` bench probes for an
+//! installed `solc` first and is skipped when none is available (e.g. sandboxed CI runners).
+//!
+//! Run with `pnpm nx run compiler:bench:rust` or `cargo bench` from `libs/compiler`.
+
+use criterion::{criterion_group, criterion_main, BatchSize, Criterion};
+use serde_json::{json, Value};
+
+use compiler::bench_support::{
+  into_js_compile_output, max_id, stitch_fragment_nodes_into_contract, StandardCompilerOutput,
+};
+use compiler::{
+  from_standard_json, Compiler, CompilerConfigOptions, CompilerSourceTarget, ContractBytecode,
+  ResolveConflictStrategy,
+};
+
+/// Synthetic solc standard-JSON output with `contracts` contract entries, mirroring what a
+/// mid-sized project build produces.
+fn synthetic_standard_output(contracts: usize) -> StandardCompilerOutput {
+  let mut contract_map = serde_json::Map::new();
+  let mut sources = serde_json::Map::new();
+  for index in 0..contracts {
+    let source = format!("Contract{index}.sol");
+    let name = format!("Contract{index}");
+    let body = json!({
+      "abi": [
+        {
+          "type": "function",
+          "name": "value",
+          "inputs": [],
+          "outputs": [{ "name": "", "type": "uint256", "internalType": "uint256" }],
+          "stateMutability": "view"
+        }
+      ],
+      "evm": {
+        "bytecode": { "object": "60".repeat(512) },
+        "deployedBytecode": {
+          "bytecode": { "object": "60".repeat(256) },
+          "immutableReferences": {}
+        },
+        "methodIdentifiers": { "value()": "3fa4f245" }
+      }
+    });
+    contract_map.insert(source.clone(), json!({ name: body }));
+    sources.insert(source, json!({ "id": index }));
+  }
+
+  serde_json::from_value(json!({
+    "contracts": Value::Object(contract_map),
+    "errors": [],
+    "sources": Value::Object(sources),
+    "version": "0.8.21"
+  }))
+  .expect("synthetic compiler output deserialises")
+}
+
+/// Synthetic source unit with one contract of `functions` members, plus a fragment contract to
+/// stitch into it.
+fn synthetic_unit_and_fragment(functions: usize) -> (Value, Value) {
+  let mut id = 1_i64;
+  let mut next = || {
+    id += 1;
+    id
+  };
+  let members: Vec<Value> = (0..functions)
+    .map(|index| {
+      json!({
+        "nodeType": "FunctionDefinition",
+        "id": next(),
+        "name": format!("member{index}"),
+        "body": { "nodeType": "Block", "id": next(), "statements": [] }
+      })
+    })
+    .collect();
+  let unit = json!({
+    "nodeType": "SourceUnit",
+    "id": 1,
+    "nodes": [
+      { "nodeType": "ContractDefinition", "id": next(), "name": "Target", "nodes": members }
+    ]
+  });
+  let fragment = json!({
+    "nodeType": "ContractDefinition",
+    "id": 1,
+    "name": "Fragment",
+    "nodes": (0..8).map(|index| json!({
+      "nodeType": "FunctionDefinition",
+      "id": 2 + index,
+      "name": format!("injected{index}"),
+      "body": { "nodeType": "Block", "id": 100 + index, "statements": [] }
+    })).collect::<Vec<Value>>()
+  });
+  (unit, fragment)
+}
+
+fn bench_output_conversion(c: &mut Criterion) {
+  let output = synthetic_standard_output(40);
+  let serialised = serde_json::to_value(&output).expect("serialise output");
+
+  c.bench_function("from_standard_json/40_contracts", |b| {
+    b.iter_batched(
+      || serde_json::from_value::<StandardCompilerOutput>(serialised.clone()).expect("output"),
+      from_standard_json,
+      BatchSize::SmallInput,
+    )
+  });
+
+  let core = from_standard_json(output);
+  c.bench_function("into_js_compile_output/40_contracts", |b| {
+    b.iter_batched(
+      || core.clone(),
+      into_js_compile_output,
+      BatchSize::SmallInput,
+    )
+  });
+  c.bench_function("compile_output_to_json/40_contracts", |b| {
+    b.iter(|| core.to_json())
+  });
+}
+
+fn bench_bytecode_from_hex(c: &mut Criterion) {
+  let runtime = format!("0x{}", "6080604052".repeat(2048));
+  c.bench_function("contract_bytecode_from_hex/10kb", |b| {
+    b.iter(|| ContractBytecode::from_hex_string(&runtime).expect("valid hex"))
+  });
+}
+
+fn bench_stitch_fragment(c: &mut Criterion) {
+  let (unit, fragment) = synthetic_unit_and_fragment(64);
+  let start_id = max_id(&unit);
+  c.bench_function("stitch_fragment_nodes_into_contract/64_members", |b| {
+    b.iter_batched(
+      || unit.clone(),
+      |mut target| {
+        stitch_fragment_nodes_into_contract(
+          &mut target,
+          0,
+          &fragment,
+          start_id,
+          ResolveConflictStrategy::Safe,
+        )
+        .expect("stitch succeeds")
+      },
+      BatchSize::SmallInput,
+    )
+  });
+}
+
+fn bench_compile_source(c: &mut Criterion) {
+  let mut options = CompilerConfigOptions::default();
+  options.cache_enabled = Some(false);
+  let Ok(compiler) = Compiler::new(Some(options)) else {
+    eprintln!("skipping compile_source bench: compiler initialisation failed");
+    return;
+  };
+  let source = include_str!("../test/fixtures/contracts/Counter.sol");
+  if compiler
+    .compile_source(CompilerSourceTarget::Text(source.to_string()), None)
+    .is_err()
+  {
+    eprintln!("skipping compile_source bench: no usable solc toolchain");
+    return;
+  }
+
+  let mut group = c.benchmark_group("end_to_end");
+  group.sample_size(10);
+  group.bench_function("compile_source/counter_fixture", |b| {
+    b.iter(|| {
+      compiler
+        .compile_source(CompilerSourceTarget::Text(source.to_string()), None)
+        .expect("compile succeeds")
+    })
+  });
+  group.finish();
+}
+
+/// The `#[napi]` glue linked into this binary references the N-API symbols Node supplies at load
+/// time. The benches never enter a JS runtime, so no-op definitions keep the loader satisfied;
+/// reaching one of these at runtime is a bug in the bench itself.
+mod napi_stubs {
+  macro_rules! napi_stub {
+    ($($name:ident),+ $(,)?) => {
+      $(
+        #[no_mangle]
+        pub extern "C" fn $name() -> i32 {
+          unreachable!(concat!(stringify!($name), " called outside a JS runtime"));
+        }
+      )+
+    };
+  }
+
+  napi_stub!(
+    napi_call_function,
+    napi_call_threadsafe_function,
+    napi_coerce_to_object,
+    napi_coerce_to_string,
+    napi_create_array_with_length,
+    napi_create_async_work,
+    napi_create_buffer,
+    napi_create_buffer_copy,
+    napi_create_double,
+    napi_create_error,
+    napi_create_external_buffer,
+    napi_create_function,
+    napi_create_int32,
+    napi_create_int64,
+    napi_create_object,
+    napi_create_promise,
+    napi_create_reference,
+    napi_create_string_utf8,
+    napi_create_threadsafe_function,
+    napi_create_uint32,
+    napi_delete_async_work,
+    napi_delete_reference,
+    napi_fatal_error,
+    napi_fatal_exception,
+    napi_get_and_clear_last_exception,
+    napi_get_array_length,
+    napi_get_boolean,
+    napi_get_buffer_info,
+    napi_get_cb_info,
+    napi_get_element,
+    napi_get_global,
+    napi_get_named_property,
+    napi_get_null,
+    napi_get_property,
+    napi_get_property_names,
+    napi_get_reference_value,
+    napi_get_typedarray_info,
+    napi_get_undefined,
+    napi_get_value_bool,
+    napi_get_value_double,
+    napi_get_value_int64,
+    napi_get_value_string_utf8,
+    napi_get_value_uint32,
+    napi_has_named_property,
+    napi_is_array,
+    napi_is_buffer,
+    napi_is_error,
+    napi_is_exception_pending,
+    napi_is_typedarray,
+    napi_new_instance,
+    napi_queue_async_work,
+    napi_reference_unref,
+    napi_reject_deferred,
+    napi_release_threadsafe_function,
+    napi_resolve_deferred,
+    napi_set_element,
+    napi_set_named_property,
+    napi_set_property,
+    napi_throw,
+    napi_typeof,
+    napi_unwrap,
+    napi_wrap,
+  );
+}
+
+criterion_group!(
+  benches,
+  bench_output_conversion,
+  bench_bytecode_from_hex,
+  bench_stitch_fragment,
+  bench_compile_source
+);
+criterion_main!(benches);
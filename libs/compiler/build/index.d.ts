@@ -20,8 +20,16 @@ export declare class Ast {
   /**
    * Inject statements at the beginning of a function body and before every return without changing the ABI.
    * The `selector` is the name of a function or its full signature, which might be useful if the function is overloaded.
+   * Pass a prebuilt `template` from `compileShadowTemplate` instead of `before`/`after` snippets
+   * when instrumenting many functions with the same probe.
    */
-  injectShadowAtEdges(selector: string, options: { before?: string | string[], after?: string | string[] } & AstConfigOptions): this
+  injectShadowAtEdges(selector: string, options: { before?: string | string[], after?: string | string[], template?: ShadowTemplate } & AstConfigOptions): this
+  /**
+   * Compile `before`/`after` snippets once into a reusable `ShadowTemplate`. The snippets are
+   * parsed through solc a single time; each later `injectShadowAtEdges` call instantiates the
+   * template with one bulk arena copy instead of re-parsing.
+   */
+  compileShadowTemplate(options: { before?: string | string[], after?: string | string[] } & AstConfigOptions): ShadowTemplate
   /**
    * Promote private/internal state variables to public visibility. Omitting `instrumentedContract`
    * applies the change to all contracts.
@@ -44,9 +52,20 @@ export declare class Ast {
 }
 export type JsAst = Ast
 
+/**
+ * Opaque handle to a compiled `before`/`after` snippet fragment, produced by
+ * `Ast.compileShadowTemplate`. Pass it back through `injectShadowAtEdges`' `template` option to
+ * instrument many functions without re-parsing the snippets per target.
+ */
+export declare class ShadowTemplate {}
+export type JsShadowTemplate = ShadowTemplate
+
 /**
  * JavaScript-facing mirror of `CompileOutput` with ergonomic getters for downstream tooling. This
  * is what the TypeScript layer surfaces as `CompileOutput<THasErrors, TPaths>`.
+ *
+ * The handle is lazy: artifacts stay in Rust and are converted to JS values on first property
+ * access per entry. Use `materialize()` to eagerly convert the full output graph instead.
  */
 export declare class CompileOutput<
   THasErrors extends boolean = boolean,
@@ -67,6 +86,11 @@ export declare class CompileOutput<
   get diagnostics(): Array<CompilerError>;
   /** Return whether the compile output contains any errors. */
   hasCompilerErrors(): this is CompileOutput<true, TSourcePaths>;
+  /**
+   * Eagerly convert every artifact and return the resulting snapshot. Escape hatch for callers
+   * that want the full object graph as plain JS data up front.
+   */
+  materialize(): CompileOutputJson;
   /** Serialise the compile output as JSON for transport or persistence. */
   toJson(): CompileOutputJson;
 }
@@ -116,6 +140,13 @@ export declare class Compiler {
    * overrides provide an explicit compiler language.
    */
   compileFiles<TFilePaths extends readonly string[] = readonly string[]>(paths: TFilePaths, options?: CompilerConfigOptions | undefined): CompileOutput<true, TFilePaths> | CompileOutput<false, TFilePaths>
+  /**
+   * Compile one source against several solc versions concurrently. The standard-JSON
+   * input is serialised once and dispatched to every requested version in parallel, so
+   * validating a library against a range of releases costs roughly as much as the
+   * slowest single version. Returns outputs keyed by the requested version strings.
+   */
+  compileMatrix(source: string, versions: ReadonlyArray<string>, options?: CompilerConfigOptions | undefined): Record<string, CompileOutput<true, undefined> | CompileOutput<false, undefined>>
   /**
    * Compile the project associated with this compiler instance, returning a snapshot
    * covering every source file that emitted artifacts.
@@ -123,14 +154,142 @@ export declare class Compiler {
   compileProject(options?: CompilerConfigOptions | undefined): CompileOutput<true, string[]> | CompileOutput<false, string[]>
   /** Compile a single contract from the attached project by its canonical name. */
   compileContract(contractName: string, options?: CompilerConfigOptions | undefined): CompileOutput<true, undefined> | CompileOutput<false, undefined>
+  /**
+   * Compile inline source text or an in-memory Solidity AST on a worker thread.
+   * Behaves exactly like `compileSource` but returns a promise and never blocks
+   * the event loop while solc runs.
+   */
+  compileSourceAsync(target: string | object, options?: CompilerConfigOptions | undefined): Promise<CompileOutput<true, undefined> | CompileOutput<false, undefined>>
+  /**
+   * Compile a keyed map of sources or AST entries on a worker thread. The async
+   * counterpart of `compileSources`.
+   */
+  compileSourcesAsync<TSources extends Record<string, string | object> = Record<string, string | object>>(sources: TSources, options?: CompilerConfigOptions | undefined): Promise<CompileOutput<true, Extract<keyof TSources, string>[]> | CompileOutput<false, Extract<keyof TSources, string>[]>>
+  /**
+   * Compile concrete files on disk on a worker thread. The async counterpart of
+   * `compileFiles`.
+   */
+  compileFilesAsync<TFilePaths extends readonly string[] = readonly string[]>(paths: TFilePaths, options?: CompilerConfigOptions | undefined): Promise<CompileOutput<true, TFilePaths> | CompileOutput<false, TFilePaths>>
+  /**
+   * Compile the attached project on a worker thread. The async counterpart of
+   * `compileProject`, allowing several project builds to run concurrently.
+   */
+  compileProjectAsync(options?: CompilerConfigOptions | undefined): Promise<CompileOutput<true, string[]> | CompileOutput<false, string[]>>
+  /**
+   * Stream contract-level results from a project compile. `onContract` fires as each
+   * contract is detached from the compiler output, so callers can start processing
+   * the first artifacts before the rest of the build has been converted; the returned
+   * promise resolves with the full diagnostic list once the stream is exhausted.
+   */
+  compileProjectStream(onContract: (entry: ProjectStreamEntry) => void, options?: CompilerConfigOptions | undefined): Promise<ReadonlyArray<CompilerError>>
+  /**
+   * Compile a single contract by canonical name on a worker thread. The async
+   * counterpart of `compileContract`.
+   */
+  compileContractAsync(contractName: string, options?: CompilerConfigOptions | undefined): Promise<CompileOutput<true, undefined> | CompileOutput<false, undefined>>
   /**
    * Return the canonicalised project paths used for artifacts, cache directories,
    * and virtual source storage.
    */
   getPaths(): ProjectPaths
+  /**
+   * Snapshot the in-memory compile cache counters. Hits are answered without touching
+   * the filesystem or spawning solc; misses fall through to a full compilation.
+   */
+  getCacheStats(): CompileCacheStats
+  /** Evict every entry from the in-memory compile cache while preserving the counters. */
+  clearCache(): void
+  /**
+   * Drop the cached project resolution shared across compilers created from the same root, so
+   * the next `fromFoundryRoot` call re-resolves remappings and import paths from scratch. Use
+   * after installing or removing dependencies under `lib/` or `node_modules` without touching
+   * `foundry.toml` or `remappings.txt` (edits to those files invalidate automatically).
+   */
+  invalidateResolutionCache(): void
+  /**
+   * Snapshot the pipeline timing spans and cache hit rates. Phase timings and the disk cache
+   * counters are process-wide (they aggregate across compiler instances and worker threads);
+   * the memory cache counters belong to this instance. Useful for attributing a slow build to
+   * solc itself versus JSON parsing, output conversion, project resolution, or AST work.
+   */
+  getMetrics(): CompilerMetrics
+  /**
+   * Create a long-lived watcher over the attached project's source and library directories.
+   * The watcher keeps the import graph in memory and recompiles only the dirty transitive
+   * closure on each change, so saves feed back in well under a full project build.
+   */
+  createWatcher(pollIntervalMs?: number | undefined): CompilerWatcher
 }
 export type JsCompiler = Compiler
 
+/**
+ * Long-lived incremental recompilation service bound to a project compiler. The watcher keeps
+ * the project's import graph in memory and, on every poll, recompiles only the files whose
+ * contents changed plus their transitive importers — the dirty closure — instead of re-running a
+ * full project build. Drive it manually with `poll()` or hand it a callback via `watch()` to get
+ * deltas pushed from a background thread.
+ */
+export declare class CompilerWatcher {
+  /**
+   * Rescan the watched directories once and recompile the dirty transitive closure. Returns
+   * `null` when no watched file changed since the previous scan.
+   */
+  poll(): CompileOutput<true, string[]> | CompileOutput<false, string[]> | null
+  /**
+   * Start a background thread that polls at the configured interval and invokes `callback` with
+   * each incremental `CompileOutput` delta (or an error when a rebuild fails). Only one watch
+   * loop may be active per watcher.
+   */
+  watch(callback: (err: Error | null, output: CompileOutput<true, string[]> | CompileOutput<false, string[]>) => void): void
+  /**
+   * Stop the background watch loop, blocking until the thread exits. The watcher can be
+   * restarted with another `watch()` call, and `poll()` keeps working either way.
+   */
+  stop(): void
+  /** Absolute paths of every source file currently tracked by the import graph. */
+  get watchedPaths(): Array<string>
+}
+
+/** Counter snapshot returned by `Compiler.getCacheStats`. */
+export interface CompileCacheStats {
+  /** Number of compilations answered from the in-memory cache. */
+  hits: number
+  /** Number of cache lookups that fell through to a full compilation. */
+  misses: number
+  /** Number of finished outputs currently resident in the cache. */
+  entries: number
+}
+
+/** Accumulated timings for one pipeline phase. */
+export interface PhaseMetrics {
+  /** Number of times the phase executed since process start. */
+  calls: number
+  /** Total wall-clock time spent in the phase, in milliseconds. */
+  totalMs: number
+  /** Mean wall-clock time per execution, in milliseconds. Zero when the phase never ran. */
+  avgMs: number
+}
+
+/** Hit/miss counters for one cache tier together with the derived hit rate. */
+export interface CacheRateMetrics {
+  /** Number of lookups answered by this tier. */
+  hits: number
+  /** Number of lookups that fell through to the tier below (or to a full compilation). */
+  misses: number
+  /** Fraction of lookups answered by this tier, or `undefined` before the first lookup. */
+  hitRate: number | undefined
+}
+
+/** Process-wide performance snapshot returned by `Compiler.getMetrics`. */
+export interface CompilerMetrics {
+  /** Per-phase wall-clock accounting keyed by phase name (`solcExecution`, `jsonParse`, ...). */
+  phases: Record<string, PhaseMetrics>
+  /** Hit rate of the persistent binary cache tier, aggregated across compiler instances. */
+  diskCache: CacheRateMetrics
+  /** Hit rate of this compiler's in-memory compile cache. */
+  memoryCache: CacheRateMetrics
+}
+
 /** Chainable JavaScript wrapper around a compiler-emitted contract state snapshot. */
 export interface Contract<
   Name extends string = string,
@@ -141,6 +300,10 @@ export interface Contract<
   readonly address: FieldValue<Map, "address">;
   readonly creationBytecode: FieldValue<Map, "creationBytecode">;
   readonly deployedBytecode: FieldValue<Map, "deployedBytecode">;
+  /** Creation bytecode as a `Buffer` sharing the native byte store (no hex round-trip). */
+  readonly bytecodeBuffer: Uint8Array | undefined;
+  /** Deployed bytecode as a `Buffer` sharing the native byte store. */
+  readonly deployedBytecodeBuffer: Uint8Array | undefined;
   readonly abi: FieldValue<Map, "abi">;
   readonly metadata: FieldValue<Map, "metadata">;
   readonly userdoc: FieldValue<Map, "userdoc">;
@@ -285,6 +448,12 @@ export interface CompilerConfigOptions {
   solcSettings?: CompilerSettings | undefined
   /** Nested Vyper-specific configuration. Falls back to environment defaults when omitted. */
   vyperSettings?: VyperCompilerConfig | undefined
+  /**
+   * Fast mode: restricts solc to the listed output sections, skipping generation of everything
+   * else (metadata, gas estimates, ASTs, …). The resulting `CompileOutput` omits unrequested
+   * sections entirely. Use `solcSettings.outputSelection` instead for selections beyond this list.
+   */
+  outputs?: Array<'abi' | 'bytecode' | 'deployedBytecode' | 'metadata' | 'storageLayout' | 'methodIdentifiers' | 'gasEstimates' | 'ast'> | undefined
   /**
    * Enables the synthetic workspace cache used for inline sources. When `true` (default) we cache
    * sources under `~/.tevm/virtual-sources`; `false` keeps everything in-memory for ephemeral runs.
@@ -309,6 +478,16 @@ export interface CompilerConfigOptions {
    * deterministic concurrency level inside CI.
    */
   solcJobs?: number | undefined
+  /**
+   * Maximum number of solc processes kept busy by the warm handle pool during inline and AST
+   * compilation. Defaults to one per logical CPU; pass `0` to reset back to that default.
+   */
+  solcPoolSize?: number | undefined
+  /**
+   * Upper bound on independent compilation shards compiled in parallel. Defaults to the logical
+   * CPU count; pass `0` to reset back to that default.
+   */
+  maxParallelJobs?: number | undefined
   /** Emits minimal artifact output when `true` (Foundry's sparse output mode). Defaults to `false`. */
   sparseOutput?: boolean | undefined
   /**
@@ -372,6 +551,20 @@ export interface CompilerError {
   vyperSourceLocation?: VyperSourceLocation
 }
 
+/**
+ * Single contract handed to JS while `compileProjectStream` drains a project compile. Entries
+ * carry the serialisable contract snapshot so consumers can start deploying or indexing a
+ * contract before the rest of the build has been converted.
+ */
+export interface ProjectStreamEntry {
+  /** Canonical source path that produced the contract. */
+  path: string
+  /** Contract name within the source file. */
+  contractName: string
+  /** Serialisable contract snapshot (ABI, bytecode, metadata, …). */
+  contract: ContractState
+}
+
 /**
  * JavaScript-facing wrapper around `solc` compiler settings. Everything is optional—unset values
  * inherit Foundry's defaults for the resolved compiler version before being sanitised.
@@ -0,0 +1,84 @@
+import { instantiateNapiModuleSync, WASI } from '@napi-rs/wasm-runtime'
+
+/**
+ * Host worker for one member of the WASI compiler pool. The main thread compiles the wasm binary
+ * once and hands every pool member the same `WebAssembly.Module`, so spawning a member only pays
+ * for instantiation. Each member owns its memory, its emnapi child threads, and one `Compiler`
+ * instance; requests are answered with plain `toJson()` snapshots because live class handles
+ * cannot cross the structured-clone boundary.
+ */
+
+let compiler = null
+let exports = null
+
+function instantiate(wasmModule) {
+  const memory = new WebAssembly.Memory({
+    initial: 4000,
+    maximum: 65536,
+    shared: true,
+  })
+  const wasi = new WASI({ version: 'preview1' })
+  const { instance, napiModule } = instantiateNapiModuleSync(wasmModule, {
+    wasi,
+    onCreateWorker() {
+      return new Worker(new URL('./wasi-worker-browser.mjs', import.meta.url), {
+        type: 'module',
+      })
+    },
+    overwriteImports(importObject) {
+      importObject.env = {
+        ...importObject.env,
+        ...importObject.napi,
+        ...importObject.emnapi,
+        memory,
+      }
+      return importObject
+    },
+    beforeInit({ instance }) {
+      for (const name of Object.keys(instance.exports)) {
+        if (name.startsWith('__napi_register__')) {
+          instance.exports[name]()
+        }
+      }
+    },
+  })
+  return { instance, napiModule }
+}
+
+function handleRequest(message) {
+  const { id, method, args } = message
+  try {
+    let output
+    switch (method) {
+      case 'compileSource':
+        output = compiler.compileSource(...args)
+        break
+      case 'compileSources':
+        output = compiler.compileSources(...args)
+        break
+      default:
+        throw new Error(`Unknown compiler pool method \`${method}\``)
+    }
+    postMessage({ type: 'response', id, result: output.toJson() })
+  } catch (error) {
+    postMessage({ type: 'response', id, error: error?.message ?? String(error) })
+  }
+}
+
+globalThis.onmessage = function (event) {
+  const message = event.data
+  if (message?.type === 'init') {
+    try {
+      const { napiModule } = instantiate(message.wasmModule)
+      exports = napiModule.exports
+      compiler = new exports.Compiler(message.compilerOptions)
+      postMessage({ type: 'ready' })
+    } catch (error) {
+      postMessage({ type: 'init-error', error: error?.message ?? String(error) })
+    }
+    return
+  }
+  if (message?.type === 'request') {
+    handleRequest(message)
+  }
+}
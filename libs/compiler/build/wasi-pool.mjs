@@ -0,0 +1,144 @@
+import __wasmUrl from './compiler.wasm32-wasi.wasm?url'
+
+/**
+ * Worker-pool front end for the WASI build. The single-instance glue in
+ * `compiler.wasi-browser.js` runs compilations on the importing thread, so a browser playground
+ * freezes for the duration of every compile and cannot overlap two of them. The pool compiles the
+ * wasm binary once, shares the resulting `WebAssembly.Module` with N host workers (spawning a
+ * member costs instantiation, not compilation), and routes each call to the first idle member —
+ * queueing when all of them are busy — so concurrent `compileSource` calls behave like the native
+ * async bindings from the caller's perspective.
+ *
+ * Pooled results are plain `CompileOutputJson` snapshots: live class handles are bound to the
+ * wasm instance that produced them and cannot cross the structured-clone boundary.
+ */
+
+const DEFAULT_POOL_SIZE = Math.max(1, (globalThis.navigator?.hardwareConcurrency ?? 4) - 1)
+
+class PoolMember {
+  constructor(worker) {
+    this.worker = worker
+    this.busy = false
+    this.pending = new Map()
+    worker.onmessage = (event) => {
+      const message = event.data
+      if (message?.type !== 'response') {
+        return
+      }
+      const settle = this.pending.get(message.id)
+      if (!settle) {
+        return
+      }
+      this.pending.delete(message.id)
+      if (message.error !== undefined) {
+        settle.reject(new Error(message.error))
+      } else {
+        settle.resolve(message.result)
+      }
+    }
+  }
+
+  request(id, method, args) {
+    return new Promise((resolve, reject) => {
+      this.pending.set(id, { resolve, reject })
+      this.worker.postMessage({ type: 'request', id, method, args })
+    })
+  }
+}
+
+function spawnMember(wasmModule, compilerOptions) {
+  const worker = new Worker(new URL('./wasi-pool-worker.mjs', import.meta.url), {
+    type: 'module',
+  })
+  return new Promise((resolve, reject) => {
+    worker.onmessage = (event) => {
+      const message = event.data
+      if (message?.type === 'ready') {
+        resolve(new PoolMember(worker))
+      } else if (message?.type === 'init-error') {
+        worker.terminate()
+        reject(new Error(`Failed to start compiler pool worker: ${message.error}`))
+      }
+    }
+    worker.postMessage({ type: 'init', wasmModule, compilerOptions })
+  })
+}
+
+class CompilerPool {
+  constructor(members) {
+    this.members = members
+    this.queue = []
+    this.nextId = 0
+    this.destroyed = false
+  }
+
+  get size() {
+    return this.members.length
+  }
+
+  compileSource(target, options) {
+    return this.run('compileSource', options === undefined ? [target] : [target, options])
+  }
+
+  compileSources(sources, options) {
+    return this.run('compileSources', options === undefined ? [sources] : [sources, options])
+  }
+
+  run(method, args) {
+    if (this.destroyed) {
+      return Promise.reject(new Error('Compiler pool has been destroyed.'))
+    }
+    return new Promise((resolve, reject) => {
+      this.queue.push({ method, args, resolve, reject })
+      this.dispatch()
+    })
+  }
+
+  dispatch() {
+    while (this.queue.length > 0) {
+      const member = this.members.find((candidate) => !candidate.busy)
+      if (!member) {
+        return
+      }
+      const task = this.queue.shift()
+      member.busy = true
+      member
+        .request(this.nextId++, task.method, task.args)
+        .then(task.resolve, task.reject)
+        .finally(() => {
+          member.busy = false
+          this.dispatch()
+        })
+    }
+  }
+
+  async destroy() {
+    this.destroyed = true
+    for (const task of this.queue.splice(0)) {
+      task.reject(new Error('Compiler pool has been destroyed.'))
+    }
+    for (const member of this.members) {
+      for (const settle of member.pending.values()) {
+        settle.reject(new Error('Compiler pool has been destroyed.'))
+      }
+      member.pending.clear()
+      member.worker.terminate()
+    }
+    this.members = []
+  }
+}
+
+/**
+ * Create a pool of `size` wasm compiler workers (one fewer than the reported hardware
+ * concurrency by default). `compilerOptions` seeds the `Compiler` instance inside every member;
+ * per-call options still override it, mirroring the native bindings.
+ */
+export async function createCompilerPool(options = {}) {
+  const size = Math.max(1, options.size ?? DEFAULT_POOL_SIZE)
+  const wasmFile = await fetch(__wasmUrl).then((response) => response.arrayBuffer())
+  const wasmModule = await WebAssembly.compile(wasmFile)
+  const members = await Promise.all(
+    Array.from({ length: size }, () => spawnMember(wasmModule, options.compilerOptions)),
+  )
+  return new CompilerPool(members)
+}
@@ -0,0 +1,641 @@
+use serde_json::{Map, Value};
+
+use super::error::AstError;
+
+/// Integer tag for the node kinds the instrumentation pipeline dispatches on. Comparing these is a
+/// single integer compare instead of a string lookup against `"nodeType"`; kinds we never inspect
+/// collapse into [`NodeKind::Other`] and keep their raw tag for serialisation.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub(crate) enum NodeKind {
+  SourceUnit,
+  ContractDefinition,
+  FunctionDefinition,
+  Block,
+  UncheckedBlock,
+  IfStatement,
+  WhileStatement,
+  ForStatement,
+  DoWhileStatement,
+  TryStatement,
+  Return,
+  InlineAssembly,
+  Other,
+}
+
+impl NodeKind {
+  fn from_tag(tag: &str) -> Self {
+    match tag {
+      "SourceUnit" => Self::SourceUnit,
+      "ContractDefinition" => Self::ContractDefinition,
+      "FunctionDefinition" => Self::FunctionDefinition,
+      "Block" => Self::Block,
+      "UncheckedBlock" => Self::UncheckedBlock,
+      "IfStatement" => Self::IfStatement,
+      "WhileStatement" => Self::WhileStatement,
+      "ForStatement" => Self::ForStatement,
+      "DoWhileStatement" => Self::DoWhileStatement,
+      "TryStatement" => Self::TryStatement,
+      "Return" => Self::Return,
+      "InlineAssembly" => Self::InlineAssembly,
+      _ => Self::Other,
+    }
+  }
+
+  const fn as_tag(&self) -> Option<&'static str> {
+    match self {
+      Self::SourceUnit => Some("SourceUnit"),
+      Self::ContractDefinition => Some("ContractDefinition"),
+      Self::FunctionDefinition => Some("FunctionDefinition"),
+      Self::Block => Some("Block"),
+      Self::UncheckedBlock => Some("UncheckedBlock"),
+      Self::IfStatement => Some("IfStatement"),
+      Self::WhileStatement => Some("WhileStatement"),
+      Self::ForStatement => Some("ForStatement"),
+      Self::DoWhileStatement => Some("DoWhileStatement"),
+      Self::TryStatement => Some("TryStatement"),
+      Self::Return => Some("Return"),
+      Self::InlineAssembly => Some("InlineAssembly"),
+      Self::Other => None,
+    }
+  }
+}
+
+/// Index of a node inside an [`AstArena`]. Copying a ref is free; the node data lives in the
+/// arena's backing vector.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub(crate) struct NodeRef(usize);
+
+/// One attribute slot of a node, kept in the order the keys were parsed so serialisation
+/// reproduces the original layout. `Id` and `Kind` mark where the `id`/`nodeType` keys sat.
+#[derive(Clone, Debug)]
+enum Attr {
+  Id,
+  Kind,
+  /// Plain JSON payload that contains no typed child (scalars, `src`, `typeDescriptions`, …).
+  Json(Value),
+  /// Single typed child node (e.g. `body`, `trueBody`).
+  Node(NodeRef),
+  /// Homogeneous list of typed children (e.g. `nodes`, `statements`).
+  Nodes(Vec<NodeRef>),
+}
+
+#[derive(Clone, Debug)]
+struct NodeData {
+  kind: NodeKind,
+  /// Raw `nodeType` tag, retained only for kinds without a static tag.
+  raw_tag: Option<String>,
+  id: Option<i64>,
+  attrs: Vec<(String, Attr)>,
+}
+
+/// Flat, typed arena holding one Solidity AST (plus any imported fragments). Nodes are created by
+/// converting solc JSON at the boundary ([`AstArena::from_value`]/[`AstArena::import`]) and written
+/// back with [`AstArena::to_value`]. The highest node id ever seen is maintained as a running
+/// counter, so allocating a fresh id is O(1) instead of a full-tree walk.
+#[derive(Debug, Default)]
+pub(crate) struct AstArena {
+  nodes: Vec<NodeData>,
+  max_id: i64,
+}
+
+impl AstArena {
+  /// Build an arena from a solc source unit (or any node-shaped JSON value).
+  pub fn from_value(value: &Value) -> Result<(Self, NodeRef), AstError> {
+    let mut arena = Self::default();
+    let root = arena.import(value)?;
+    Ok((arena, root))
+  }
+
+  /// Import a node-shaped JSON value into the arena, returning its ref. Ids encountered anywhere
+  /// in the subtree (including untyped attribute payloads) raise the running max-id counter.
+  pub fn import(&mut self, value: &Value) -> Result<NodeRef, AstError> {
+    let map = value
+      .as_object()
+      .filter(|map| is_node(map))
+      .ok_or_else(|| {
+        AstError::InvalidContractStructure("Expected an AST node object with a nodeType tag".into())
+      })?;
+    Ok(self.import_node(map))
+  }
+
+  fn import_node(&mut self, map: &Map<String, Value>) -> NodeRef {
+    let tag = map
+      .get("nodeType")
+      .and_then(Value::as_str)
+      .unwrap_or_default()
+      .to_string();
+    let kind = NodeKind::from_tag(&tag);
+    let id = map.get("id").and_then(Value::as_i64);
+    if let Some(id) = id {
+      self.max_id = self.max_id.max(id);
+    }
+
+    let mut attrs = Vec::with_capacity(map.len());
+    for (key, value) in map {
+      let attr = match key.as_str() {
+        "id" => Attr::Id,
+        "nodeType" => Attr::Kind,
+        _ => self.import_attr(value),
+      };
+      attrs.push((key.clone(), attr));
+    }
+
+    let index = self.nodes.len();
+    self.nodes.push(NodeData {
+      kind,
+      raw_tag: if kind == NodeKind::Other {
+        Some(tag)
+      } else {
+        None
+      },
+      id,
+      attrs,
+    });
+    NodeRef(index)
+  }
+
+  fn import_attr(&mut self, value: &Value) -> Attr {
+    match value {
+      Value::Object(map) if is_node(map) => Attr::Node(self.import_node(map)),
+      Value::Array(items)
+        if items
+          .iter()
+          .all(|item| item.as_object().is_some_and(is_node)) =>
+      {
+        let children = items
+          .iter()
+          .map(|item| self.import_node(item.as_object().expect("checked above")))
+          .collect();
+        Attr::Nodes(children)
+      }
+      other => {
+        self.observe_ids(other);
+        Attr::Json(other.clone())
+      }
+    }
+  }
+
+  /// Track `id` keys inside untyped payloads so the running counter never hands out a duplicate.
+  fn observe_ids(&mut self, value: &Value) {
+    match value {
+      Value::Object(map) => {
+        if let Some(id) = map.get("id").and_then(Value::as_i64) {
+          self.max_id = self.max_id.max(id);
+        }
+        for child in map.values() {
+          self.observe_ids(child);
+        }
+      }
+      Value::Array(items) => {
+        for item in items {
+          self.observe_ids(item);
+        }
+      }
+      _ => {}
+    }
+  }
+
+  /// Serialise a subtree back into the solc JSON shape.
+  pub fn to_value(&self, node: NodeRef) -> Value {
+    let data = &self.nodes[node.0];
+    let mut map = Map::new();
+    for (key, attr) in &data.attrs {
+      let value = match attr {
+        Attr::Id => match data.id {
+          Some(id) => Value::Number(id.into()),
+          None => continue,
+        },
+        Attr::Kind => Value::String(self.tag(node).to_string()),
+        Attr::Json(value) => value.clone(),
+        Attr::Node(child) => self.to_value(*child),
+        Attr::Nodes(children) => {
+          Value::Array(children.iter().map(|child| self.to_value(*child)).collect())
+        }
+      };
+      map.insert(key.clone(), value);
+    }
+    Value::Object(map)
+  }
+
+  pub fn kind(&self, node: NodeRef) -> NodeKind {
+    self.nodes[node.0].kind
+  }
+
+  fn tag(&self, node: NodeRef) -> &str {
+    let data = &self.nodes[node.0];
+    data
+      .kind
+      .as_tag()
+      .or(data.raw_tag.as_deref())
+      .unwrap_or_default()
+  }
+
+  /// Allocate a fresh node id. O(1): bumps the running maximum.
+  pub fn next_id(&mut self) -> i64 {
+    self.max_id += 1;
+    self.max_id
+  }
+
+  /// Untyped attribute payload (scalar or non-node JSON) stored under `key`.
+  pub fn attr(&self, node: NodeRef, key: &str) -> Option<&Value> {
+    self.nodes[node.0].attrs.iter().find_map(|(name, attr)| {
+      if name == key {
+        match attr {
+          Attr::Json(value) => Some(value),
+          _ => None,
+        }
+      } else {
+        None
+      }
+    })
+  }
+
+  pub fn attr_str(&self, node: NodeRef, key: &str) -> Option<&str> {
+    self.attr(node, key).and_then(Value::as_str)
+  }
+
+  /// Single typed child stored under `key` (e.g. a function's `body`).
+  pub fn child(&self, node: NodeRef, key: &str) -> Option<NodeRef> {
+    self.nodes[node.0].attrs.iter().find_map(|(name, attr)| {
+      if name == key {
+        match attr {
+          Attr::Node(child) => Some(*child),
+          _ => None,
+        }
+      } else {
+        None
+      }
+    })
+  }
+
+  /// Typed child list stored under `key` (e.g. `nodes`, `statements`), cloned so callers can
+  /// iterate while mutating the arena.
+  pub fn children(&self, node: NodeRef, key: &str) -> Option<Vec<NodeRef>> {
+    self.nodes[node.0].attrs.iter().find_map(|(name, attr)| {
+      if name == key {
+        match attr {
+          Attr::Nodes(children) => Some(children.clone()),
+          // An empty JSON array cannot be distinguished from an empty child list at import
+          // time; treat it as one so statements can be inserted into empty blocks.
+          Attr::Json(Value::Array(items)) if items.is_empty() => Some(Vec::new()),
+          _ => None,
+        }
+      } else {
+        None
+      }
+    })
+  }
+
+  fn children_slot(&mut self, node: NodeRef, key: &str) -> Option<&mut Vec<NodeRef>> {
+    let attrs = &mut self.nodes[node.0].attrs;
+    let position = attrs.iter().position(|(name, attr)| {
+      name == key
+        && match attr {
+          Attr::Nodes(_) => true,
+          Attr::Json(Value::Array(items)) => items.is_empty(),
+          _ => false,
+        }
+    })?;
+    if matches!(attrs[position].1, Attr::Json(_)) {
+      attrs[position].1 = Attr::Nodes(Vec::new());
+    }
+    match &mut attrs[position].1 {
+      Attr::Nodes(children) => Some(children),
+      _ => None,
+    }
+  }
+
+  pub fn insert_child(
+    &mut self,
+    parent: NodeRef,
+    key: &str,
+    index: usize,
+    child: NodeRef,
+  ) -> Result<(), AstError> {
+    let slot = self.children_slot(parent, key).ok_or_else(|| {
+      AstError::InvalidContractStructure(format!("Node is missing a `{key}` child list"))
+    })?;
+    if index > slot.len() {
+      return Err(AstError::InvalidContractStructure(format!(
+        "Insertion index out of bounds for `{key}`"
+      )));
+    }
+    slot.insert(index, child);
+    Ok(())
+  }
+
+  pub fn push_child(&mut self, parent: NodeRef, key: &str, child: NodeRef) -> Result<(), AstError> {
+    let slot = self.children_slot(parent, key).ok_or_else(|| {
+      AstError::InvalidContractStructure(format!("Node is missing a `{key}` child list"))
+    })?;
+    slot.push(child);
+    Ok(())
+  }
+
+  /// Swap the typed child stored under `key` for another node, returning the previous child.
+  pub fn replace_child(
+    &mut self,
+    parent: NodeRef,
+    key: &str,
+    child: NodeRef,
+  ) -> Result<NodeRef, AstError> {
+    let attrs = &mut self.nodes[parent.0].attrs;
+    for (name, attr) in attrs.iter_mut() {
+      if name == key {
+        if let Attr::Node(existing) = attr {
+          let previous = *existing;
+          *attr = Attr::Node(child);
+          return Ok(previous);
+        }
+      }
+    }
+    Err(AstError::InvalidContractStructure(format!(
+      "Node is missing a `{key}` child"
+    )))
+  }
+
+  /// Create a node from scratch (used when synthesising wrapper blocks). Attributes are inserted
+  /// in the order supplied; an `id` is allocated from the running counter.
+  pub fn new_node(&mut self, kind: NodeKind, extra_attrs: Vec<(String, Value)>) -> NodeRef {
+    let id = self.next_id();
+    let mut attrs = vec![
+      ("id".to_string(), Attr::Id),
+      ("nodeType".to_string(), Attr::Kind),
+    ];
+    for (key, value) in extra_attrs {
+      attrs.push((key, Attr::Json(value)));
+    }
+    let index = self.nodes.len();
+    self.nodes.push(NodeData {
+      kind,
+      raw_tag: None,
+      id: Some(id),
+      attrs,
+    });
+    NodeRef(index)
+  }
+
+  /// Attach a typed child list to a node that does not have one yet (used together with
+  /// [`AstArena::new_node`] when synthesising wrapper blocks).
+  pub fn add_children_attr(&mut self, node: NodeRef, key: &str, children: Vec<NodeRef>) {
+    self.nodes[node.0]
+      .attrs
+      .push((key.to_string(), Attr::Nodes(children)));
+  }
+
+  /// Deep-copy a subtree, assigning fresh ids from the running counter to every node (and to any
+  /// node-shaped object buried inside untyped payloads, mirroring `utils::clone_with_new_ids`).
+  pub fn clone_with_new_ids(&mut self, node: NodeRef) -> NodeRef {
+    let data = self.nodes[node.0].clone();
+    let index = self.nodes.len();
+    self.nodes.push(NodeData {
+      kind: data.kind,
+      raw_tag: data.raw_tag,
+      id: None,
+      attrs: Vec::new(),
+    });
+    let clone = NodeRef(index);
+    // Assign the parent id before descending so the numbering matches the
+    // pre-order walk `utils::clone_with_new_ids` performs on raw JSON.
+    let id = self.next_id();
+    self.nodes[index].id = Some(id);
+
+    let mut attrs = Vec::with_capacity(data.attrs.len());
+    for (key, attr) in &data.attrs {
+      let attr = match attr {
+        Attr::Id => Attr::Id,
+        Attr::Kind => Attr::Kind,
+        Attr::Json(value) => {
+          let mut clone = value.clone();
+          self.renumber_json(&mut clone);
+          Attr::Json(clone)
+        }
+        Attr::Node(child) => Attr::Node(self.clone_with_new_ids(*child)),
+        Attr::Nodes(children) => Attr::Nodes(
+          children
+            .iter()
+            .map(|child| self.clone_with_new_ids(*child))
+            .collect(),
+        ),
+      };
+      attrs.push((key.clone(), attr));
+    }
+    if !attrs.iter().any(|(_, attr)| matches!(attr, Attr::Id)) {
+      attrs.push(("id".to_string(), Attr::Id));
+    }
+    self.nodes[index].attrs = attrs;
+    clone
+  }
+
+  /// Bulk-copy every node of `template` into this arena, returning the refs corresponding to
+  /// `roots`. Unlike [`AstArena::clone_with_new_ids`] this is a single contiguous extend of the
+  /// backing vector plus a constant id-offset pass: copied ids become `template_id + offset`
+  /// where `offset` is this arena's running maximum, so they cannot collide with existing ids
+  /// and no per-node recursive walk is needed.
+  pub fn copy_template(&mut self, template: &AstArena, roots: &[NodeRef]) -> Vec<NodeRef> {
+    let base = self.nodes.len();
+    let offset = self.max_id;
+    let mut extra = template.max_id;
+    for data in &template.nodes {
+      let mut clone = data.clone();
+      clone.id = Some(match clone.id {
+        Some(id) => id + offset,
+        None => {
+          extra += 1;
+          extra + offset
+        }
+      });
+      if !clone.attrs.iter().any(|(_, attr)| matches!(attr, Attr::Id)) {
+        clone.attrs.push(("id".to_string(), Attr::Id));
+      }
+      for (_, attr) in clone.attrs.iter_mut() {
+        match attr {
+          Attr::Node(child) => *child = NodeRef(child.0 + base),
+          Attr::Nodes(children) => {
+            for child in children.iter_mut() {
+              *child = NodeRef(child.0 + base);
+            }
+          }
+          Attr::Json(value) => offset_json_ids(value, offset),
+          Attr::Id | Attr::Kind => {}
+        }
+      }
+      self.nodes.push(clone);
+    }
+    self.max_id = offset + extra;
+    roots.iter().map(|root| NodeRef(root.0 + base)).collect()
+  }
+
+  fn renumber_json(&mut self, value: &mut Value) {
+    match value {
+      Value::Object(map) => {
+        if map.get("nodeType").is_some() {
+          let id = self.next_id();
+          map.insert("id".to_string(), Value::Number(id.into()));
+        }
+        for child in map.values_mut() {
+          self.renumber_json(child);
+        }
+      }
+      Value::Array(items) => {
+        for item in items {
+          self.renumber_json(item);
+        }
+      }
+      _ => {}
+    }
+  }
+}
+
+fn is_node(map: &Map<String, Value>) -> bool {
+  map.get("nodeType").is_some_and(Value::is_string)
+}
+
+/// Shift the `id` of every node-shaped object buried inside an untyped payload by a constant,
+/// keeping template copies aligned with the id offset applied to typed nodes.
+fn offset_json_ids(value: &mut Value, offset: i64) {
+  match value {
+    Value::Object(map) => {
+      if map.get("nodeType").is_some() {
+        if let Some(id) = map.get("id").and_then(Value::as_i64) {
+          map.insert("id".to_string(), Value::Number((id + offset).into()));
+        }
+      }
+      for child in map.values_mut() {
+        offset_json_ids(child, offset);
+      }
+    }
+    Value::Array(items) => {
+      for item in items {
+        offset_json_ids(item, offset);
+      }
+    }
+    _ => {}
+  }
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+  use serde_json::json;
+
+  fn sample_unit() -> Value {
+    json!({
+      "nodeType": "SourceUnit",
+      "id": 10,
+      "src": "0:0:0",
+      "nodes": [
+        {
+          "nodeType": "ContractDefinition",
+          "id": 7,
+          "name": "Target",
+          "nodes": [
+            {
+              "nodeType": "FunctionDefinition",
+              "id": 5,
+              "name": "run",
+              "body": {
+                "nodeType": "Block",
+                "id": 6,
+                "statements": []
+              }
+            }
+          ]
+        }
+      ]
+    })
+  }
+
+  #[test]
+  fn round_trips_solc_json() {
+    let unit = sample_unit();
+    let (arena, root) = AstArena::from_value(&unit).expect("import unit");
+    assert_eq!(arena.to_value(root), unit);
+  }
+
+  #[test]
+  fn tracks_max_id_and_allocates_in_constant_time() {
+    let (mut arena, _root) = AstArena::from_value(&sample_unit()).expect("import unit");
+    assert_eq!(arena.next_id(), 11);
+    assert_eq!(arena.next_id(), 12);
+  }
+
+  #[test]
+  fn import_raises_running_counter_past_fragment_ids() {
+    let (mut arena, _root) = AstArena::from_value(&sample_unit()).expect("import unit");
+    arena
+      .import(&json!({ "nodeType": "Return", "id": 90 }))
+      .expect("import fragment");
+    assert_eq!(arena.next_id(), 91);
+  }
+
+  #[test]
+  fn typed_kind_tags_and_child_access() {
+    let (arena, root) = AstArena::from_value(&sample_unit()).expect("import unit");
+    assert_eq!(arena.kind(root), NodeKind::SourceUnit);
+    let contract = arena.children(root, "nodes").expect("unit nodes")[0];
+    assert_eq!(arena.kind(contract), NodeKind::ContractDefinition);
+    assert_eq!(arena.attr_str(contract, "name"), Some("Target"));
+    let function = arena.children(contract, "nodes").expect("members")[0];
+    let body = arena.child(function, "body").expect("body");
+    assert_eq!(arena.kind(body), NodeKind::Block);
+    assert_eq!(arena.children(body, "statements").expect("list").len(), 0);
+  }
+
+  #[test]
+  fn clone_with_new_ids_renumbers_the_subtree() {
+    let (mut arena, root) = AstArena::from_value(&sample_unit()).expect("import unit");
+    let contract = arena.children(root, "nodes").expect("unit nodes")[0];
+    let clone = arena.clone_with_new_ids(contract);
+    let value = arena.to_value(clone);
+    assert_eq!(value["id"], 11);
+    assert_eq!(value["nodes"][0]["id"], 12);
+    assert_eq!(value["nodes"][0]["body"]["id"], 13);
+    let original = arena.to_value(contract);
+    assert_eq!(original["id"], 7);
+  }
+
+  #[test]
+  fn copy_template_offsets_ids_and_remaps_children() {
+    let template_statement = json!({
+      "nodeType": "ExpressionStatement",
+      "id": 2,
+      "expression": { "nodeType": "Identifier", "id": 1, "name": "probe" }
+    });
+    let (template, root) = AstArena::from_value(&template_statement).expect("import template");
+
+    let (mut arena, unit) = AstArena::from_value(&sample_unit()).expect("import unit");
+    let copies = arena.copy_template(&template, &[root]);
+    assert_eq!(copies.len(), 1);
+
+    let value = arena.to_value(copies[0]);
+    assert_eq!(value["nodeType"], "ExpressionStatement");
+    assert_eq!(value["id"], 12);
+    assert_eq!(value["expression"]["id"], 11);
+    assert_eq!(value["expression"]["name"], "probe");
+
+    // The original unit is untouched and the running counter moved past the copied ids.
+    assert_eq!(arena.to_value(unit), sample_unit());
+    assert_eq!(arena.next_id(), 13);
+
+    // A second instantiation lands in a fresh id range.
+    let second = arena.copy_template(&template, &[root]);
+    assert_eq!(arena.to_value(second[0])["id"], 15);
+  }
+
+  #[test]
+  fn statements_can_be_inserted_into_empty_blocks() {
+    let (mut arena, root) = AstArena::from_value(&sample_unit()).expect("import unit");
+    let contract = arena.children(root, "nodes").expect("unit nodes")[0];
+    let function = arena.children(contract, "nodes").expect("members")[0];
+    let body = arena.child(function, "body").expect("body");
+    let statement = arena
+      .import(&json!({ "nodeType": "Return", "id": 42 }))
+      .expect("import statement");
+    arena
+      .insert_child(body, "statements", 0, statement)
+      .expect("insert statement");
+    let value = arena.to_value(body);
+    assert_eq!(value["statements"][0]["nodeType"], "Return");
+  }
+}
@@ -14,8 +14,9 @@ use crate::internal::{
   },
   errors::{map_err_with_context, Error, Result},
   logging::{ensure_rust_logger, update_level},
+  metrics,
   settings::default_output_selection,
-  solc,
+  solc, solc_pool,
 };
 
 const VIRTUAL_SOURCE_PATH: &str = "__VIRTUAL__.sol";
@@ -133,7 +134,7 @@ pub fn inject_shadow_at_edges(
   );
 
   let config = resolve_config(state, overrides)?;
-  let solc = solc::ensure_installed(&config.solc.version)?;
+  let checkout = solc_pool::checkout(&config.solc.version, None)?;
 
   let idx = {
     let target_ast = target_ast(state)?;
@@ -147,7 +148,7 @@ pub fn inject_shadow_at_edges(
     selector,
     before,
     after,
-    &solc,
+    checkout.solc(),
     &config.solc.settings,
   )?;
 
@@ -162,6 +163,80 @@ pub fn inject_shadow_at_edges(
   Ok(())
 }
 
+/// Parse edge-instrumentation snippets into a reusable [`instrumenter::ShadowTemplate`]. Mass
+/// instrumentation workflows compile the probe once and hand the template back to
+/// `injectShadowAtEdges` for every target function.
+pub fn compile_shadow_template(
+  state: &State,
+  before: &[String],
+  after: &[String],
+  overrides: Option<&AstConfigOptions>,
+) -> Result<instrumenter::ShadowTemplate> {
+  let config = resolve_config(state, overrides)?;
+  let checkout = solc_pool::checkout(&config.solc.version, None)?;
+  info!(
+    target: LOG_TARGET,
+    "compiling shadow template (before={}, after={}, solc={})",
+    before.len(),
+    after.len(),
+    config.solc.version
+  );
+  instrumenter::ShadowTemplate::compile(before, after, checkout.solc(), &config.solc.settings)
+}
+
+/// [`inject_shadow_at_edges`] with a prebuilt template: the snippet parse is skipped and the
+/// statements are instantiated into the unit with a single arena copy.
+pub fn inject_shadow_at_edges_with_template(
+  state: &mut State,
+  selector: &str,
+  template: &instrumenter::ShadowTemplate,
+  overrides: Option<&AstConfigOptions>,
+) -> Result<()> {
+  let contract = contract_override(state, overrides).map(|name| name.to_owned());
+  info!(
+    target: LOG_TARGET,
+    "injecting edge instrumentation from template (selector={}, contract={:?})",
+    selector,
+    contract
+  );
+
+  let config = resolve_config(state, overrides)?;
+  if template.solc_version() != &config.solc.version {
+    return Err(Error::new(format!(
+      "Shadow template was compiled with solc {} but this Ast resolves to solc {}. \
+       Recompile the template with compileShadowTemplate using the same solcVersion.",
+      template.solc_version(),
+      config.solc.version
+    )));
+  }
+  let checkout = solc_pool::checkout(&config.solc.version, None)?;
+
+  let idx = {
+    let target_ast = target_ast(state)?;
+    find_contract_index(state, target_ast, contract.as_deref())?
+  };
+
+  let unit = target_ast_mut(state)?;
+  instrumenter::inject_edges_with_template(
+    unit,
+    idx,
+    selector,
+    template,
+    checkout.solc(),
+    &config.solc.settings,
+  )?;
+
+  info!(
+    target: LOG_TARGET,
+    "edge instrumentation applied from template (selector={}, contract={:?})",
+    selector,
+    contract
+  );
+
+  state.cached_compile_output = None;
+  Ok(())
+}
+
 pub fn expose_internal_variables(
   state: &mut State,
   overrides: Option<&AstConfigOptions>,
@@ -467,6 +542,7 @@ fn compile_output_internal(
   state: &mut State,
   overrides: Option<&AstConfigOptions>,
 ) -> Result<CompileOutput> {
+  let _span = metrics::span(metrics::Phase::AstOperation);
   let use_cache = overrides.is_none();
   if use_cache {
     if let Some(cached) = &state.cached_compile_output {
@@ -518,13 +594,13 @@ fn load_source_text(
   overrides: Option<&AstConfigOptions>,
 ) -> Result<()> {
   let config = resolve_config(state, overrides)?;
-  let solc = solc::ensure_installed(&config.solc.version)?;
+  let checkout = solc_pool::checkout(&config.solc.version, None)?;
 
   let mut settings = config.solc.settings.clone();
   settings.stop_after = None;
 
   let ast = map_err_with_context(
-    AstOrchestrator::parse_source_unit(source, VIRTUAL_SOURCE_PATH, &solc, &settings),
+    AstOrchestrator::parse_source_unit(source, VIRTUAL_SOURCE_PATH, checkout.solc(), &settings),
     "Failed to parse target source",
   )?;
 
@@ -555,11 +631,15 @@ fn inject_fragment_string(
   overrides: Option<&AstConfigOptions>,
 ) -> Result<()> {
   let config = resolve_config(state, overrides)?;
-  let solc = solc::ensure_installed(&config.solc.version)?;
+  let checkout = solc_pool::checkout(&config.solc.version, None)?;
 
   let strategy = config.resolve_conflict_strategy;
   let fragment_contract = map_err_with_context(
-    AstOrchestrator::parse_fragment_contract(fragment_source, &solc, &config.solc.settings),
+    AstOrchestrator::parse_fragment_contract(
+      fragment_source,
+      checkout.solc(),
+      &config.solc.settings,
+    ),
     "Failed to parse AST fragment",
   )?;
 
@@ -1,15 +1,18 @@
+use std::collections::HashMap;
 use std::path::PathBuf;
+use std::sync::{Arc, Mutex, OnceLock};
 
 use foundry_compilers::artifacts::{Settings, SolcInput, SolcLanguage, Source, Sources};
 use foundry_compilers::solc::Solc;
-use serde_json::{Map, Value};
+use semver::Version;
+use serde_json::Value;
 
 use crate::internal::errors::{map_err_with_context, Error, Result};
 
 use super::{
+  arena::{AstArena, NodeKind, NodeRef},
   orchestrator::AstOrchestrator,
   parser, stitcher,
-  utils::{self},
 };
 
 #[derive(Debug)]
@@ -24,6 +27,68 @@ enum FunctionSelectorKind {
   Constructor,
 }
 
+/// A compiled edge-instrumentation fragment: the `before`/`after` snippets parsed through solc
+/// once and retained as a private arena. Instantiating the template into a target unit is a
+/// single bulk arena copy plus an id-offset pass ([`AstArena::copy_template`]), so injecting the
+/// same probe into hundreds of functions never re-parses or re-walks the snippet JSON.
+#[derive(Debug)]
+pub struct ShadowTemplate {
+  arena: AstArena,
+  before: Vec<NodeRef>,
+  after: Vec<NodeRef>,
+  solc_version: Version,
+}
+
+impl ShadowTemplate {
+  pub(crate) fn compile(
+    before_snippets: &[String],
+    after_snippets: &[String],
+    solc: &Solc,
+    settings: &Settings,
+  ) -> Result<Self> {
+    if before_snippets.is_empty() && after_snippets.is_empty() {
+      return Err(Error::new(
+        "injectShadowAtEdges requires a `before` and/or `after` snippet.",
+      ));
+    }
+    let before_statements = parse_statements(before_snippets, solc, settings)?;
+    let after_statements = parse_statements(after_snippets, solc, settings)?;
+    let mut arena = AstArena::default();
+    let before = import_statements(&mut arena, before_statements.as_slice())?;
+    let after = import_statements(&mut arena, after_statements.as_slice())?;
+    Ok(Self {
+      arena,
+      before,
+      after,
+      solc_version: solc.version.clone(),
+    })
+  }
+
+  /// Solc version the snippets were parsed with; injection targets must resolve to the same
+  /// version so the statement JSON matches the unit's AST dialect.
+  pub(crate) fn solc_version(&self) -> &Version {
+    &self.solc_version
+  }
+
+  /// Copy the template statements into `arena`, returning the `before`/`after` root refs. One
+  /// bulk copy covers both lists.
+  fn instantiate(&self, arena: &mut AstArena) -> (Vec<NodeRef>, Vec<NodeRef>) {
+    let roots: Vec<NodeRef> = self
+      .before
+      .iter()
+      .chain(self.after.iter())
+      .copied()
+      .collect();
+    let mut copies = arena.copy_template(&self.arena, &roots);
+    let after = copies.split_off(self.before.len());
+    (copies, after)
+  }
+}
+
+/// Inject `before`/`after` statement snippets at the entry and exit edges of a function. The solc
+/// JSON unit is imported into a typed [`AstArena`] once at the start and serialised back once at
+/// the end; all traversal, cloning, and id allocation in between works on integer kind tags and
+/// the arena's O(1) running id counter.
 pub fn inject_edges(
   unit: &mut Value,
   contract_idx: usize,
@@ -33,53 +98,57 @@ pub fn inject_edges(
   solc: &Solc,
   settings: &Settings,
 ) -> Result<()> {
-  if before_snippets.is_empty() && after_snippets.is_empty() {
-    return Err(Error::new(
-      "injectShadowAtEdges requires a `before` and/or `after` snippet.",
-    ));
-  }
-
-  let mut next_id = utils::max_id(unit);
+  let template = ShadowTemplate::compile(before_snippets, after_snippets, solc, settings)?;
+  inject_edges_with_template(unit, contract_idx, selector, &template, solc, settings)
+}
 
-  let contract = contract_mut_at(unit, contract_idx)?;
+/// [`inject_edges`] with a prebuilt [`ShadowTemplate`], skipping snippet parsing entirely.
+pub fn inject_edges_with_template(
+  unit: &mut Value,
+  contract_idx: usize,
+  selector: &str,
+  template: &ShadowTemplate,
+  solc: &Solc,
+  settings: &Settings,
+) -> Result<()> {
   let selector_kind = parse_selector(selector, solc, settings)?;
-  let function = resolve_function_mut(contract, &selector_kind)?;
 
-  let body = function
-    .get_mut("body")
-    .ok_or_else(|| Error::new("Cannot instrument a function without an implementation"))?;
+  let (mut arena, root) = AstArena::from_value(unit).map_err(|err| Error::new(err.to_string()))?;
+  let contract = contract_at(&arena, root, contract_idx)?;
+  let function = resolve_function(&arena, contract, &selector_kind)?;
 
-  if body.is_null() {
-    return Err(Error::new(
-      "Cannot instrument a function without an implementation",
-    ));
-  }
+  let body = arena
+    .child(function, "body")
+    .ok_or_else(|| Error::new("Cannot instrument a function without an implementation"))?;
 
-  ensure_no_inline_assembly(body)?;
+  ensure_no_inline_assembly(&arena, body)?;
 
-  let before_statements = parse_statements(before_snippets, solc, settings)?;
-  let after_statements = parse_statements(after_snippets, solc, settings)?;
+  let (before_templates, after_templates) = template.instantiate(&mut arena);
 
-  if !before_statements.is_empty() || !after_statements.is_empty() {
-    let statements = body
-      .get_mut("statements")
-      .and_then(|value| value.as_array_mut())
-      .ok_or_else(|| Error::new("Function body missing statements array"))?;
+  if !before_templates.is_empty() || !after_templates.is_empty() {
+    if arena.children(body, "statements").is_none() {
+      return Err(Error::new("Function body missing statements array"));
+    }
 
-    if !before_statements.is_empty() {
-      let mut clones = clone_statements(&before_statements, &mut next_id);
-      for (offset, statement) in clones.drain(..).enumerate() {
-        statements.insert(offset, statement);
-      }
+    for (offset, template) in before_templates.iter().enumerate() {
+      let clone = arena.clone_with_new_ids(*template);
+      arena
+        .insert_child(body, "statements", offset, clone)
+        .map_err(|err| Error::new(err.to_string()))?;
     }
 
-    if !after_statements.is_empty() {
-      inject_after(statements, &after_statements, &mut next_id)?;
-      let mut tail = clone_statements(&after_statements, &mut next_id);
-      statements.append(&mut tail);
+    if !after_templates.is_empty() {
+      inject_after(&mut arena, body, &after_templates)?;
+      for template in &after_templates {
+        let clone = arena.clone_with_new_ids(*template);
+        arena
+          .push_child(body, "statements", clone)
+          .map_err(|err| Error::new(err.to_string()))?;
+      }
     }
   }
 
+  *unit = arena.to_value(root);
   Ok(())
 }
 
@@ -138,49 +207,61 @@ fn first_function_definition(contract: &Value) -> Option<&Value> {
     })
 }
 
-fn resolve_function_mut<'a>(
-  contract: &'a mut Value,
+fn contract_at(arena: &AstArena, root: NodeRef, idx: usize) -> Result<NodeRef> {
+  let nodes = arena
+    .children(root, "nodes")
+    .ok_or_else(|| Error::new("Source unit has no nodes array"))?;
+  let Some(node) = nodes.get(idx).copied() else {
+    return Err(Error::new("Invalid contract index"));
+  };
+  if arena.kind(node) != NodeKind::ContractDefinition {
+    return Err(Error::new("Target index is not a contract definition"));
+  }
+  Ok(node)
+}
+
+fn resolve_function(
+  arena: &AstArena,
+  contract: NodeRef,
   selector: &FunctionSelectorKind,
-) -> Result<&'a mut Value> {
-  let nodes = contract
-    .get_mut("nodes")
-    .and_then(|value| value.as_array_mut())
+) -> Result<NodeRef> {
+  let members = arena
+    .children(contract, "nodes")
     .ok_or_else(|| Error::new("Contract has no members to instrument"))?;
 
-  let mut matches: Vec<usize> = Vec::new();
+  let mut matches: Vec<NodeRef> = Vec::new();
 
-  for (idx, node) in nodes.iter().enumerate() {
-    if node_type(node) != Some("FunctionDefinition") {
+  for member in members {
+    if arena.kind(member) != NodeKind::FunctionDefinition {
       continue;
     }
     match selector {
       FunctionSelectorKind::Fallback => {
-        if matches!(function_kind(node), Some("fallback")) {
-          matches.push(idx);
+        if arena.attr_str(member, "kind") == Some("fallback") {
+          matches.push(member);
         }
       }
       FunctionSelectorKind::Receive => {
-        if matches!(function_kind(node), Some("receive")) {
-          matches.push(idx);
+        if arena.attr_str(member, "kind") == Some("receive") {
+          matches.push(member);
         }
       }
       FunctionSelectorKind::Constructor => {
-        if matches!(function_kind(node), Some("constructor")) {
-          matches.push(idx);
+        if arena.attr_str(member, "kind") == Some("constructor") {
+          matches.push(member);
         }
       }
       FunctionSelectorKind::Canonical { name, signature } => {
-        if node_name(node) == Some(name.as_str()) {
-          let current_signature =
-            stitcher::function_signature(node).map_err(|err| Error::new(err.to_string()))?;
+        if arena.attr_str(member, "name") == Some(name.as_str()) {
+          let current_signature = function_signature(arena, member)?;
           if &current_signature == signature {
-            matches.push(idx);
+            matches.push(member);
           }
         }
       }
       FunctionSelectorKind::Name(name) => {
-        if node_name(node) == Some(name.as_str()) {
-          matches.push(idx);
+        if arena.attr_str(member, "name") == Some(name.as_str()) {
+          matches.push(member);
         }
       }
     }
@@ -198,64 +279,110 @@ fn resolve_function_mut<'a>(
     ));
   }
 
-  let idx = matches[0];
-  nodes
-    .get_mut(idx)
-    .ok_or_else(|| Error::new("Invalid function index after resolution"))
+  Ok(matches[0])
 }
 
-fn ensure_no_inline_assembly(body: &Value) -> Result<()> {
-  let statements = body
-    .get("statements")
-    .and_then(|value| value.as_array())
+/// Arena-side counterpart of `stitcher::function_signature`; both produce the same type keys so
+/// signatures computed from the fragment JSON and the imported unit compare equal.
+fn function_signature(arena: &AstArena, function: NodeRef) -> Result<Vec<String>> {
+  let parameter_list = arena
+    .child(function, "parameters")
+    .ok_or_else(|| Error::new("FunctionDefinition parameters list is missing"))?;
+  let parameters = arena
+    .children(parameter_list, "parameters")
+    .ok_or_else(|| Error::new("FunctionDefinition parameters list is missing"))?;
+
+  parameters
+    .iter()
+    .enumerate()
+    .map(|(idx, param)| parameter_type_key(arena, *param, idx))
+    .collect()
+}
+
+fn parameter_type_key(arena: &AstArena, param: NodeRef, idx: usize) -> Result<String> {
+  if let Some(identifier) = arena
+    .attr(param, "typeDescriptions")
+    .and_then(|value| value.get("typeIdentifier"))
+    .and_then(Value::as_str)
+  {
+    return Ok(identifier.to_string());
+  }
+  if let Some(type_string) = arena
+    .attr(param, "typeDescriptions")
+    .and_then(|value| value.get("typeString"))
+    .and_then(Value::as_str)
+  {
+    return Ok(type_string.to_string());
+  }
+  if let Some(type_name) = arena.child(param, "typeName") {
+    let mut value = arena.to_value(type_name);
+    drop_ids(&mut value);
+    return serde_json::to_string(&value).map_err(|err| Error::new(err.to_string()));
+  }
+  Ok(format!("__anon_parameter_{}", idx))
+}
+
+fn drop_ids(node: &mut Value) {
+  match node {
+    Value::Object(map) => {
+      map.remove("id");
+      for child in map.values_mut() {
+        drop_ids(child);
+      }
+    }
+    Value::Array(items) => {
+      for item in items {
+        drop_ids(item);
+      }
+    }
+    _ => {}
+  }
+}
+
+fn ensure_no_inline_assembly(arena: &AstArena, body: NodeRef) -> Result<()> {
+  let statements = arena
+    .children(body, "statements")
     .ok_or_else(|| Error::new("Function body missing statements array"))?;
   for statement in statements {
-    ensure_no_inline_assembly_in_statement(statement)?;
+    ensure_no_inline_assembly_in_statement(arena, statement)?;
   }
   Ok(())
 }
 
-fn ensure_no_inline_assembly_in_statement(statement: &Value) -> Result<()> {
-  match node_type(statement) {
-    Some("InlineAssembly") => Err(Error::new(
+fn ensure_no_inline_assembly_in_statement(arena: &AstArena, statement: NodeRef) -> Result<()> {
+  match arena.kind(statement) {
+    NodeKind::InlineAssembly => Err(Error::new(
       "injectShadowAtEdges does not support functions that contain inline assembly.",
     )),
-    Some("Block") | Some("UncheckedBlock") => {
-      let statements = statement
-        .get("statements")
-        .and_then(|value| value.as_array())
+    NodeKind::Block | NodeKind::UncheckedBlock => {
+      let statements = arena
+        .children(statement, "statements")
         .ok_or_else(|| Error::new("Block missing statements array"))?;
       for child in statements {
-        ensure_no_inline_assembly_in_statement(child)?;
+        ensure_no_inline_assembly_in_statement(arena, child)?;
       }
       Ok(())
     }
-    Some("IfStatement") => {
-      if let Some(true_body) = statement.get("trueBody") {
-        ensure_no_inline_assembly_in_statement(true_body)?;
+    NodeKind::IfStatement => {
+      if let Some(true_body) = arena.child(statement, "trueBody") {
+        ensure_no_inline_assembly_in_statement(arena, true_body)?;
       }
-      if let Some(false_body) = statement.get("falseBody") {
-        ensure_no_inline_assembly_in_statement(false_body)?;
+      if let Some(false_body) = arena.child(statement, "falseBody") {
+        ensure_no_inline_assembly_in_statement(arena, false_body)?;
       }
       Ok(())
     }
-    Some("WhileStatement") | Some("ForStatement") => {
-      if let Some(body) = statement.get("body") {
-        ensure_no_inline_assembly_in_statement(body)?;
+    NodeKind::WhileStatement | NodeKind::ForStatement | NodeKind::DoWhileStatement => {
+      if let Some(body) = arena.child(statement, "body") {
+        ensure_no_inline_assembly_in_statement(arena, body)?;
       }
       Ok(())
     }
-    Some("DoWhileStatement") => {
-      if let Some(body) = statement.get("body") {
-        ensure_no_inline_assembly_in_statement(body)?;
-      }
-      Ok(())
-    }
-    Some("TryStatement") => {
-      if let Some(clauses) = statement.get("clauses").and_then(|value| value.as_array()) {
+    NodeKind::TryStatement => {
+      if let Some(clauses) = arena.children(statement, "clauses") {
         for clause in clauses {
-          if let Some(block) = clause.get("block") {
-            ensure_no_inline_assembly_in_statement(block)?;
+          if let Some(block) = arena.child(clause, "block") {
+            ensure_no_inline_assembly_in_statement(arena, block)?;
           }
         }
       }
@@ -265,9 +392,42 @@ fn ensure_no_inline_assembly_in_statement(statement: &Value) -> Result<()> {
   }
 }
 
-fn parse_statements(snippets: &[String], solc: &Solc, settings: &Settings) -> Result<Vec<Value>> {
+/// Process-wide cache of parsed snippet statements. The tracer injects the same handful of
+/// snippets into hundreds of functions, and each `parse_statements` call otherwise pays a full
+/// solc round-trip; caching the parsed statement arrays leaves only the id-remapping clone on
+/// repeat injections.
+fn fragment_cache() -> &'static Mutex<HashMap<blake3::Hash, Arc<Vec<Value>>>> {
+  static CACHE: OnceLock<Mutex<HashMap<blake3::Hash, Arc<Vec<Value>>>>> = OnceLock::new();
+  CACHE.get_or_init(|| Mutex::new(HashMap::new()))
+}
+
+/// Cache key for a snippet fragment: the wrapped fragment text together with everything that can
+/// change what solc produces for it (compiler version and sanitised settings).
+fn fragment_cache_key(
+  fragment: &str,
+  version: &Version,
+  settings: &Settings,
+) -> Result<blake3::Hash> {
+  let mut hasher = blake3::Hasher::new();
+  hasher.update(fragment.as_bytes());
+  hasher.update(b"\0");
+  hasher.update(version.to_string().as_bytes());
+  hasher.update(b"\0");
+  let serialised = map_err_with_context(
+    serde_json::to_vec(settings),
+    "Failed to serialise solc settings",
+  )?;
+  hasher.update(&serialised);
+  Ok(hasher.finalize())
+}
+
+fn parse_statements(
+  snippets: &[String],
+  solc: &Solc,
+  settings: &Settings,
+) -> Result<Arc<Vec<Value>>> {
   if snippets.is_empty() {
-    return Ok(Vec::new());
+    return Ok(Arc::new(Vec::new()));
   }
 
   let joined = snippets
@@ -277,7 +437,7 @@ fn parse_statements(snippets: &[String], solc: &Solc, settings: &Settings) -> Re
     .collect::<Vec<_>>();
 
   if joined.is_empty() {
-    return Ok(Vec::new());
+    return Ok(Arc::new(Vec::new()));
   }
 
   let mut fragment_lines = Vec::new();
@@ -293,6 +453,15 @@ fn parse_statements(snippets: &[String], solc: &Solc, settings: &Settings) -> Re
 
   let fragment = fragment_lines.join("\n");
 
+  let key = fragment_cache_key(&fragment, &solc.version, settings)?;
+  if let Some(cached) = fragment_cache()
+    .lock()
+    .ok()
+    .and_then(|cache| cache.get(&key).cloned())
+  {
+    return Ok(cached);
+  }
+
   let contract = parse_fragment_contract(&fragment, solc, settings)?;
   let function = first_function_definition(&contract)
     .ok_or_else(|| Error::new("Failed to parse instrumentation snippets"))?;
@@ -308,74 +477,76 @@ fn parse_statements(snippets: &[String], solc: &Solc, settings: &Settings) -> Re
     .get("statements")
     .and_then(|value| value.as_array())
     .ok_or_else(|| Error::new("Instrumentation snippet missing statements array"))?;
-  Ok(statements.to_vec())
+  let statements = Arc::new(statements.to_vec());
+  if let Ok(mut cache) = fragment_cache().lock() {
+    cache.insert(key, Arc::clone(&statements));
+  }
+  Ok(statements)
 }
 
-fn clone_statements(statements: &[Value], next_id: &mut i64) -> Vec<Value> {
+/// Import parsed snippet statements into the arena once; each injection site then clones the
+/// template refs instead of re-walking JSON.
+fn import_statements(arena: &mut AstArena, statements: &[Value]) -> Result<Vec<NodeRef>> {
   statements
     .iter()
-    .map(|statement| utils::clone_with_new_ids(statement, next_id))
+    .map(|statement| {
+      arena
+        .import(statement)
+        .map_err(|err| Error::new(err.to_string()))
+    })
     .collect()
 }
 
-fn inject_after(statements: &mut Vec<Value>, template: &[Value], next_id: &mut i64) -> Result<()> {
+fn inject_after(arena: &mut AstArena, block: NodeRef, templates: &[NodeRef]) -> Result<()> {
   let mut idx = 0;
-  while idx < statements.len() {
-    let node_type = node_type(&statements[idx]);
-    match node_type {
-      Some("Return") => {
-        let clones = clone_statements(template, next_id);
-        let len = clones.len();
-        for (offset, clone) in clones.into_iter().enumerate() {
-          statements.insert(idx + offset, clone);
+  loop {
+    let statements = arena
+      .children(block, "statements")
+      .ok_or_else(|| Error::new("Block missing statements array"))?;
+    let Some(statement) = statements.get(idx).copied() else {
+      break;
+    };
+    match arena.kind(statement) {
+      NodeKind::Return => {
+        let len = templates.len();
+        for (offset, template) in templates.iter().enumerate() {
+          let clone = arena.clone_with_new_ids(*template);
+          arena
+            .insert_child(block, "statements", idx + offset, clone)
+            .map_err(|err| Error::new(err.to_string()))?;
         }
         idx += len + 1;
       }
-      Some("Block") | Some("UncheckedBlock") => {
-        let block_statements = statements[idx]
-          .get_mut("statements")
-          .and_then(|value| value.as_array_mut())
-          .ok_or_else(|| Error::new("Block missing statements array"))?;
-        inject_after(block_statements, template, next_id)?;
+      NodeKind::Block | NodeKind::UncheckedBlock => {
+        inject_after(arena, statement, templates)?;
         idx += 1;
       }
-      Some("IfStatement") => {
-        if let Some(true_body) = statements[idx].get_mut("trueBody") {
-          inject_into_block_or_statement(true_body, template, next_id)?;
+      NodeKind::IfStatement => {
+        if let Some(true_body) = arena.child(statement, "trueBody") {
+          inject_into_block_or_statement(arena, statement, "trueBody", true_body, templates)?;
         }
-        if let Some(false_body) = statements[idx].get_mut("falseBody") {
-          inject_into_block_or_statement(false_body, template, next_id)?;
+        if let Some(false_body) = arena.child(statement, "falseBody") {
+          inject_into_block_or_statement(arena, statement, "falseBody", false_body, templates)?;
         }
         idx += 1;
       }
-      Some("WhileStatement") | Some("ForStatement") => {
-        if let Some(body) = statements[idx].get_mut("body") {
-          inject_into_block_or_statement(body, template, next_id)?;
+      NodeKind::WhileStatement | NodeKind::ForStatement => {
+        if let Some(body) = arena.child(statement, "body") {
+          inject_into_block_or_statement(arena, statement, "body", body, templates)?;
         }
         idx += 1;
       }
-      Some("DoWhileStatement") => {
-        if let Some(body) = statements[idx].get_mut("body") {
-          let block_statements = body
-            .get_mut("statements")
-            .and_then(|value| value.as_array_mut())
-            .ok_or_else(|| Error::new("DoWhile body missing statements array"))?;
-          inject_after(block_statements, template, next_id)?;
+      NodeKind::DoWhileStatement => {
+        if let Some(body) = arena.child(statement, "body") {
+          inject_after(arena, body, templates)?;
         }
         idx += 1;
       }
-      Some("TryStatement") => {
-        if let Some(clauses) = statements[idx]
-          .get_mut("clauses")
-          .and_then(|value| value.as_array_mut())
-        {
+      NodeKind::TryStatement => {
+        if let Some(clauses) = arena.children(statement, "clauses") {
           for clause in clauses {
-            if let Some(block) = clause.get_mut("block") {
-              let block_statements = block
-                .get_mut("statements")
-                .and_then(|value| value.as_array_mut())
-                .ok_or_else(|| Error::new("Try clause block missing statements array"))?;
-              inject_after(block_statements, template, next_id)?;
+            if let Some(clause_block) = arena.child(clause, "block") {
+              inject_after(arena, clause_block, templates)?;
             }
           }
         }
@@ -390,47 +561,38 @@ fn inject_after(statements: &mut Vec<Value>, template: &[Value], next_id: &mut i
 }
 
 fn inject_into_block_or_statement(
-  node: &mut Value,
-  template: &[Value],
-  next_id: &mut i64,
+  arena: &mut AstArena,
+  parent: NodeRef,
+  key: &str,
+  node: NodeRef,
+  templates: &[NodeRef],
 ) -> Result<()> {
-  if node_type(node) == Some("Block") || node_type(node) == Some("UncheckedBlock") {
-    let statements = node
-      .get_mut("statements")
-      .and_then(|value| value.as_array_mut())
-      .ok_or_else(|| Error::new("Block missing statements array"))?;
-    inject_after(statements, template, next_id)
+  let block = if matches!(arena.kind(node), NodeKind::Block | NodeKind::UncheckedBlock) {
+    node
   } else {
-    ensure_block(node, next_id)?;
-    let statements = node
-      .get_mut("statements")
-      .and_then(|value| value.as_array_mut())
-      .ok_or_else(|| Error::new("Converted block missing statements array"))?;
-    inject_after(statements, template, next_id)
-  }
+    wrap_in_block(arena, parent, key, node)?
+  };
+  inject_after(arena, block, templates)
 }
 
-fn ensure_block(node: &mut Value, next_id: &mut i64) -> Result<()> {
-  if node_type(node) == Some("Block") || node_type(node) == Some("UncheckedBlock") {
-    return Ok(());
-  }
-
-  let original = std::mem::replace(node, Value::Null);
-  let src = original
-    .get("src")
+/// Replace a bare statement child with a synthesised `Block` wrapping it, so statement injection
+/// always has a statements list to target.
+fn wrap_in_block(
+  arena: &mut AstArena,
+  parent: NodeRef,
+  key: &str,
+  node: NodeRef,
+) -> Result<NodeRef> {
+  let src = arena
+    .attr(node, "src")
     .cloned()
     .unwrap_or_else(|| Value::String("0:0:0".to_string()));
-
-  *next_id += 1;
-
-  let mut block_map = Map::new();
-  block_map.insert("nodeType".to_string(), Value::String("Block".to_string()));
-  block_map.insert("id".to_string(), Value::Number((*next_id).into()));
-  block_map.insert("src".to_string(), src);
-  block_map.insert("statements".to_string(), Value::Array(vec![original]));
-
-  *node = Value::Object(block_map);
-  Ok(())
+  let block = arena.new_node(NodeKind::Block, vec![("src".to_string(), src)]);
+  arena.add_children_attr(block, "statements", vec![node]);
+  arena
+    .replace_child(parent, key, block)
+    .map_err(|err| Error::new(err.to_string()))?;
+  Ok(block)
 }
 
 fn parse_fragment_contract(fragment: &str, solc: &Solc, settings: &Settings) -> Result<Value> {
@@ -458,32 +620,6 @@ fn parse_fragment_contract(fragment: &str, solc: &Solc, settings: &Settings) ->
   Ok(contract)
 }
 
-fn contract_mut_at<'a>(unit: &'a mut Value, idx: usize) -> Result<&'a mut Value> {
-  let nodes = unit
-    .get_mut("nodes")
-    .and_then(|value| value.as_array_mut())
-    .ok_or_else(|| Error::new("Source unit has no nodes array"))?;
-  let Some(node) = nodes.get_mut(idx) else {
-    return Err(Error::new("Invalid contract index"));
-  };
-  if node_type(node) != Some("ContractDefinition") {
-    return Err(Error::new("Target index is not a contract definition"));
-  }
-  Ok(node)
-}
-
-fn node_type(value: &Value) -> Option<&str> {
-  value.get("nodeType").and_then(|value| value.as_str())
-}
-
-fn node_name(value: &Value) -> Option<&str> {
-  value.get("name").and_then(|value| value.as_str())
-}
-
-fn function_kind(value: &Value) -> Option<&str> {
-  value.get("kind").and_then(|value| value.as_str())
-}
-
 #[cfg(test)]
 mod tests {
   use super::*;
@@ -496,53 +632,119 @@ mod tests {
   }
 
   #[test]
-  fn ensure_block_wraps_expression_statements() {
-    let mut node = json!({
-      "nodeType": "ExpressionStatement",
-      "expression": { "nodeType": "Identifier", "name": "foo" }
+  fn wrap_in_block_converts_expression_statements() {
+    let parent = json!({
+      "nodeType": "IfStatement",
+      "id": 1,
+      "trueBody": {
+        "nodeType": "ExpressionStatement",
+        "id": 2,
+        "expression": { "nodeType": "Identifier", "id": 3, "name": "foo" }
+      }
     });
-    let mut next_id = 0;
-    ensure_block(&mut node, &mut next_id).expect("wrap into block");
-
-    assert_eq!(node["nodeType"], "Block");
-    assert!(node["id"].as_i64().is_some());
-    let statements = node["statements"].as_array().expect("statements array");
+    let (mut arena, root) = AstArena::from_value(&parent).expect("import statement");
+    let true_body = arena.child(root, "trueBody").expect("trueBody");
+    let block = wrap_in_block(&mut arena, root, "trueBody", true_body).expect("wrap into block");
+
+    assert_eq!(arena.kind(block), NodeKind::Block);
+    let value = arena.to_value(root);
+    assert_eq!(value["trueBody"]["nodeType"], "Block");
+    assert!(value["trueBody"]["id"].as_i64().is_some());
+    let statements = value["trueBody"]["statements"]
+      .as_array()
+      .expect("statements array");
     assert_eq!(statements.len(), 1);
     assert_eq!(statements[0]["expression"]["name"], "foo");
-    assert_eq!(next_id, 1);
   }
 
   #[test]
   fn inject_after_inserts_template_before_returns() {
-    let mut statements = vec![json!({ "nodeType": "Return" })];
-    let template = vec![json!({
-      "nodeType": "ExpressionStatement",
-      "expression": { "nodeType": "Identifier", "name": "probe" }
-    })];
-
-    let mut next_id = 0;
-    inject_after(&mut statements, &template, &mut next_id).expect("inject");
-
+    let body = json!({
+      "nodeType": "Block",
+      "id": 1,
+      "statements": [{ "nodeType": "Return", "id": 2 }]
+    });
+    let (mut arena, block) = AstArena::from_value(&body).expect("import block");
+    let template = arena
+      .import(&json!({
+        "nodeType": "ExpressionStatement",
+        "id": 3,
+        "expression": { "nodeType": "Identifier", "id": 4, "name": "probe" }
+      }))
+      .expect("import template");
+
+    inject_after(&mut arena, block, &[template]).expect("inject");
+
+    let value = arena.to_value(block);
+    let statements = value["statements"].as_array().expect("statements");
     assert_eq!(statements.len(), 2);
     assert_eq!(statements[0]["nodeType"], "ExpressionStatement");
     assert_eq!(statements[0]["expression"]["name"], "probe");
     assert_eq!(statements[1]["nodeType"], "Return");
-    assert_eq!(next_id, 2);
+  }
+
+  #[test]
+  fn shadow_template_instantiates_into_fresh_id_ranges() {
+    let statement = json!({
+      "nodeType": "ExpressionStatement",
+      "id": 2,
+      "expression": { "nodeType": "Identifier", "id": 1, "name": "probe" }
+    });
+    let (template_arena, root) = AstArena::from_value(&statement).expect("import template");
+    let template = ShadowTemplate {
+      arena: template_arena,
+      before: vec![root],
+      after: Vec::new(),
+      solc_version: Version::new(0, 8, 30),
+    };
+
+    let body = json!({ "nodeType": "Block", "id": 5, "statements": [] });
+    let (mut arena, block) = AstArena::from_value(&body).expect("import block");
+    let (before, after) = template.instantiate(&mut arena);
+    assert_eq!(before.len(), 1);
+    assert!(after.is_empty());
+
+    arena
+      .insert_child(block, "statements", 0, before[0])
+      .expect("insert statement");
+    let value = arena.to_value(block);
+    assert_eq!(value["statements"][0]["expression"]["name"], "probe");
+    assert_eq!(value["statements"][0]["id"], 7);
+    assert_eq!(value["statements"][0]["expression"]["id"], 6);
   }
 
   #[test]
   fn ensure_no_inline_assembly_detects_assembly_nodes() {
     let block = json!({
       "nodeType": "Block",
+      "id": 1,
       "statements": [
-        { "nodeType": "InlineAssembly" }
+        { "nodeType": "InlineAssembly", "id": 2 }
       ]
     });
+    let (arena, body) = AstArena::from_value(&block).expect("import block");
 
-    let err = ensure_no_inline_assembly(&block);
+    let err = ensure_no_inline_assembly(&arena, body);
     assert!(err.is_err());
   }
 
+  #[test]
+  fn fragment_cache_key_tracks_snippet_version_and_settings() {
+    let settings = Settings::default();
+    let version = Version::new(0, 8, 30);
+
+    let first = fragment_cache_key("x = 1;", &version, &settings).expect("key");
+    let second = fragment_cache_key("x = 1;", &version, &settings).expect("key");
+    assert_eq!(first, second);
+
+    let other_snippet = fragment_cache_key("x = 2;", &version, &settings).expect("key");
+    assert_ne!(first, other_snippet);
+
+    let other_version =
+      fragment_cache_key("x = 1;", &Version::new(0, 8, 29), &settings).expect("key");
+    assert_ne!(first, other_version);
+  }
+
   #[test]
   fn parse_selector_parses_canonical_signature() {
     let Some(solc) = find_default_solc() else {
@@ -1,23 +1,28 @@
+use std::sync::Arc;
+
 use napi::bindgen_prelude::*;
 use napi::{Env, JsObject, JsUnknown, ValueType};
 use serde_json::Value;
 
+mod arena;
 pub mod core;
-mod error;
+pub(crate) mod error;
 mod instrumenter;
 pub(crate) mod orchestrator;
 pub(crate) mod parser;
-mod stitcher;
+pub(crate) mod stitcher;
 pub(crate) mod utils;
 
 #[cfg(test)]
 mod ast_tests;
 
 use core::{
-  compile_output, expose_internal_functions, expose_internal_variables, from_source, init,
-  inject_shadow, inject_shadow_at_edges, source_unit, source_unit_mut, validate,
+  compile_output, compile_shadow_template, expose_internal_functions, expose_internal_variables,
+  from_source, init, inject_shadow, inject_shadow_at_edges, inject_shadow_at_edges_with_template,
+  source_unit, source_unit_mut, validate,
 };
 pub use core::{FragmentTarget, SourceTarget, State};
+pub use instrumenter::ShadowTemplate;
 use utils::{from_js_value, to_js_value};
 
 use crate::compiler::output::{into_js_compile_output, CompileOutput, JsCompileOutput};
@@ -65,6 +70,27 @@ impl Ast {
     Ok(self)
   }
 
+  /// Parse `before`/`after` snippets once into a reusable [`ShadowTemplate`]; pass the handle to
+  /// [`Ast::inject_shadow_at_edges_with_template`] when instrumenting many functions.
+  pub fn compile_shadow_template(
+    &self,
+    before: &[String],
+    after: &[String],
+    options: Option<AstConfigOptions>,
+  ) -> Result<ShadowTemplate> {
+    compile_shadow_template(&self.state, before, after, options.as_ref())
+  }
+
+  pub fn inject_shadow_at_edges_with_template(
+    &mut self,
+    selector: &str,
+    template: &ShadowTemplate,
+    options: Option<AstConfigOptions>,
+  ) -> Result<&mut Self> {
+    inject_shadow_at_edges_with_template(&mut self.state, selector, template, options.as_ref())?;
+    Ok(self)
+  }
+
   pub fn expose_internal_variables(
     &mut self,
     options: Option<AstConfigOptions>,
@@ -117,6 +143,14 @@ impl Ast {
   }
 }
 
+/// Opaque handle to a compiled `before`/`after` snippet fragment, produced by
+/// `Ast.compileShadowTemplate`. Pass it back through `injectShadowAtEdges`' `template` option to
+/// instrument many functions without re-parsing the snippets per target.
+#[napi(js_name = "ShadowTemplate")]
+pub struct JsShadowTemplate {
+  inner: Arc<ShadowTemplate>,
+}
+
 /// High-level helper for manipulating Solidity ASTs prior to recompilation.
 #[napi(js_name = "Ast")]
 #[derive(Clone)]
@@ -196,8 +230,10 @@ impl JsAst {
 
   /// Inject statements at the beginning of a function body and before every return without changing the ABI.
   /// The `selector` is the name of a function or its full signature, which might be useful if the function is overloaded.
+  /// Pass a prebuilt `template` from `compileShadowTemplate` instead of `before`/`after` snippets
+  /// when instrumenting many functions with the same probe.
   #[napi(
-    ts_args_type = "selector: string, options: { before?: string | string[], after?: string | string[] } & AstConfigOptions",
+    ts_args_type = "selector: string, options: { before?: string | string[], after?: string | string[], template?: ShadowTemplate } & AstConfigOptions",
     ts_return_type = "this"
   )]
   pub fn inject_shadow_at_edges(
@@ -206,10 +242,23 @@ impl JsAst {
     selector: String,
     options: Option<JsUnknown>,
   ) -> napi::Result<JsAst> {
-    let (before, after, overrides) = parse_edges_options(&env, options)?;
+    let (before, after, template, overrides) = parse_edges_options(&env, options)?;
+    if let Some(template) = template {
+      if !before.is_empty() || !after.is_empty() {
+        return Err(napi_error(
+          "injectShadowAtEdges accepts either a prebuilt `template` or `before`/`after` snippets, not both.",
+        ));
+      }
+      to_napi_result(
+        self
+          .inner
+          .inject_shadow_at_edges_with_template(&selector, &template, overrides),
+      )?;
+      return Ok(self.clone());
+    }
     if before.is_empty() && after.is_empty() {
       return Err(napi_error(
-        "injectShadowAtEdges requires a `before` and/or `after` snippet.",
+        "injectShadowAtEdges requires a `before`/`after` snippet or a prebuilt `template`.",
       ));
     }
     to_napi_result(
@@ -220,6 +269,34 @@ impl JsAst {
     Ok(self.clone())
   }
 
+  /// Compile `before`/`after` snippets once into a reusable `ShadowTemplate`. The snippets are
+  /// parsed through solc a single time; each later `injectShadowAtEdges` call instantiates the
+  /// template with one bulk arena copy instead of re-parsing.
+  #[napi(
+    ts_args_type = "options: { before?: string | string[], after?: string | string[] } & AstConfigOptions",
+    ts_return_type = "ShadowTemplate"
+  )]
+  pub fn compile_shadow_template(
+    &self,
+    env: Env,
+    options: Option<JsUnknown>,
+  ) -> napi::Result<JsShadowTemplate> {
+    let (before, after, template, overrides) = parse_edges_options(&env, options)?;
+    if template.is_some() {
+      return Err(napi_error(
+        "compileShadowTemplate takes `before`/`after` snippets, not an existing template.",
+      ));
+    }
+    let compiled = to_napi_result(
+      self
+        .inner
+        .compile_shadow_template(&before, &after, overrides),
+    )?;
+    Ok(JsShadowTemplate {
+      inner: Arc::new(compiled),
+    })
+  }
+
   /// Promote private/internal state variables to public visibility. Omitting `instrumentedContract`
   /// applies the change to all contracts.
   #[napi(
@@ -315,22 +392,44 @@ fn parse_fragment_input(
 fn parse_edges_options(
   env: &Env,
   options: Option<JsUnknown>,
-) -> napi::Result<(Vec<String>, Vec<String>, Option<AstConfigOptions>)> {
+) -> napi::Result<(
+  Vec<String>,
+  Vec<String>,
+  Option<Arc<ShadowTemplate>>,
+  Option<AstConfigOptions>,
+)> {
   let Some(value) = options else {
-    return Ok((Vec::new(), Vec::new(), None));
+    return Ok((Vec::new(), Vec::new(), None, None));
   };
 
   let object = value.coerce_to_object()?;
 
   let before = extract_statement_list(&object, "before")?;
   let after = extract_statement_list(&object, "after")?;
+  let template = extract_shadow_template(&object)?;
 
   let overrides = parse_js_ast_options(env, Some(object.into_unknown()))?
     .as_ref()
     .map(|opts| AstConfigOptions::try_from(opts))
     .transpose()?;
 
-  Ok((before, after, overrides))
+  Ok((before, after, template, overrides))
+}
+
+fn extract_shadow_template(object: &JsObject) -> napi::Result<Option<Arc<ShadowTemplate>>> {
+  if !object.has_named_property("template")? {
+    return Ok(None);
+  }
+  let value = object.get_named_property::<JsUnknown>("template")?;
+  if matches!(value.get_type()?, ValueType::Undefined | ValueType::Null) {
+    return Ok(None);
+  }
+  drop(value);
+  let instance: ClassInstance<JsShadowTemplate> =
+    object.get_named_property("template").map_err(|_| {
+      napi_error("`template` must be a ShadowTemplate produced by compileShadowTemplate.")
+    })?;
+  Ok(Some(Arc::clone(&instance.inner)))
 }
 
 fn extract_statement_list(object: &JsObject, property: &str) -> napi::Result<Vec<String>> {
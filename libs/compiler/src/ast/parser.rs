@@ -3,9 +3,41 @@ use std::path::PathBuf;
 use foundry_compilers::artifacts::{Settings, SolcInput, SolcLanguage, Source, Sources};
 use foundry_compilers::solc::Solc;
 
+use std::collections::BTreeMap;
+
 use super::error::AstError;
+use serde::Deserialize;
 use serde_json::Value;
 
+use crate::internal::json;
+use crate::internal::metrics;
+
+/// The subset of solc's standard-JSON output this parser consumes: diagnostics plus the per-source
+/// AST. Deserializing into this instead of a full `Value` tree skips building nodes for the
+/// contract artifacts solc emits alongside the AST.
+#[derive(Deserialize)]
+struct ParseOutput {
+  #[serde(default)]
+  errors: Vec<ParseDiagnostic>,
+  #[serde(default)]
+  sources: BTreeMap<String, ParsedSource>,
+}
+
+#[derive(Deserialize)]
+struct ParseDiagnostic {
+  #[serde(default)]
+  severity: String,
+  #[serde(default, rename = "formattedMessage")]
+  formatted_message: Option<String>,
+  #[serde(default)]
+  message: Option<String>,
+}
+
+#[derive(Deserialize)]
+struct ParsedSource {
+  ast: Option<Value>,
+}
+
 // TODO: remove in favor of compile_source with correct settings once we add ast to output
 fn parse_source_ast_internal(
   source: &str,
@@ -19,42 +51,38 @@ fn parse_source_ast_internal(
   let mut input = SolcInput::new(SolcLanguage::Solidity, sources, settings.clone());
   input.sanitize(&solc.version);
 
-  let compiler_output: serde_json::Value = solc
-    .compile_as::<SolcInput, _>(&input)
-    .map_err(|err| AstError::CompilerError(err.to_string()))?;
-
-  if let Some(errors) = compiler_output
-    .get("errors")
-    .and_then(|value| value.as_array())
-  {
-    let mut messages = Vec::new();
-    for error in errors {
-      let severity = error
-        .get("severity")
-        .and_then(|value| value.as_str())
-        .unwrap_or_default();
-      if severity.eq_ignore_ascii_case("error") {
-        let message = error
-          .get("formattedMessage")
-          .and_then(|value| value.as_str())
-          .or_else(|| error.get("message").and_then(|value| value.as_str()))
-          .unwrap_or("Compilation error");
-        messages.push(message.to_string());
-      }
-    }
-    if !messages.is_empty() {
-      return Err(AstError::CompilerError(messages.join("\n")));
-    }
+  let stdout = {
+    let _span = metrics::span(metrics::Phase::SolcExecution);
+    solc
+      .compile_output(&input)
+      .map_err(|err| AstError::CompilerError(err.to_string()))?
+  };
+  let mut compiler_output: ParseOutput =
+    json::from_solc_stdout(stdout, "Failed to parse solc output")
+      .map_err(|err| AstError::CompilerError(err.to_string()))?;
+
+  let messages: Vec<String> = compiler_output
+    .errors
+    .iter()
+    .filter(|error| error.severity.eq_ignore_ascii_case("error"))
+    .map(|error| {
+      error
+        .formatted_message
+        .as_deref()
+        .or(error.message.as_deref())
+        .unwrap_or("Compilation error")
+        .to_string()
+    })
+    .collect();
+  if !messages.is_empty() {
+    return Err(AstError::CompilerError(messages.join("\n")));
   }
 
-  let ast_value = compiler_output
-    .get("sources")
-    .and_then(|sources| sources.get(file_name))
-    .and_then(|entry| entry.get("ast"))
-    .ok_or_else(|| AstError::ParseFailed("Failed to extract AST".to_string()))?
-    .clone();
-
-  Ok(ast_value)
+  compiler_output
+    .sources
+    .remove(file_name)
+    .and_then(|entry| entry.ast)
+    .ok_or_else(|| AstError::ParseFailed("Failed to extract AST".to_string()))
 }
 
 pub fn parse_source_ast(
@@ -2,6 +2,7 @@ use serde_json::{json, Value};
 use std::collections::HashMap;
 
 use crate::internal::config::ResolveConflictStrategy;
+use crate::internal::metrics;
 
 use super::{error::AstError, utils};
 
@@ -53,6 +54,7 @@ pub fn stitch_fragment_nodes_into_contract(
   max_target_id: i64,
   strategy: ResolveConflictStrategy,
 ) -> Result<(), AstError> {
+  let _span = metrics::span(metrics::Phase::AstOperation);
   let target_contract = contract_mut_at(target, contract_idx)?;
   let fragment_nodes = fragment_contract
     .get("nodes")
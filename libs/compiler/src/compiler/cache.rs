@@ -0,0 +1,206 @@
+use std::collections::HashMap;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::Mutex;
+
+use log::info;
+
+use super::input::CompilationInput;
+use super::output::CompileOutput;
+use crate::internal::config::{CompilerConfig, CompilerLanguage};
+use crate::internal::errors::{map_err_with_context, Result};
+
+const LOG_TARGET: &str = "tevm::compiler.cache";
+
+/// In-memory compile cache shared by every clone of a compiler [`State`](super::core::State).
+/// Entries are keyed by a blake3 digest of the source contents together with the parts of the
+/// resolved configuration that influence compiler output, so identical inline compilations skip the
+/// virtual-source disk round-trip and the solc invocation entirely.
+#[derive(Debug, Default)]
+pub struct CompileCache {
+  entries: Mutex<HashMap<blake3::Hash, CompileOutput>>,
+  hits: AtomicU64,
+  misses: AtomicU64,
+}
+
+/// Snapshot of the cache counters surfaced through the JS bindings.
+#[derive(Clone, Copy, Debug)]
+pub struct CompileCacheStats {
+  pub hits: u64,
+  pub misses: u64,
+  pub entries: u64,
+}
+
+impl CompileCache {
+  /// Look up a finished output for `key`, updating the hit/miss counters.
+  pub fn get(&self, key: &blake3::Hash) -> Option<CompileOutput> {
+    let entries = self.entries.lock().ok()?;
+    match entries.get(key) {
+      Some(output) => {
+        self.hits.fetch_add(1, Ordering::Relaxed);
+        info!(
+          target: LOG_TARGET,
+          "compile cache hit (key={})",
+          key.to_hex()
+        );
+        Some(output.clone())
+      }
+      None => {
+        self.misses.fetch_add(1, Ordering::Relaxed);
+        None
+      }
+    }
+  }
+
+  /// Store a finished output under `key`. Poisoned locks are treated as a disabled cache rather
+  /// than an error since the cache is purely an optimisation.
+  pub fn insert(&self, key: blake3::Hash, output: CompileOutput) {
+    if let Ok(mut entries) = self.entries.lock() {
+      entries.insert(key, output);
+    }
+  }
+
+  pub fn stats(&self) -> CompileCacheStats {
+    let entries = self
+      .entries
+      .lock()
+      .map(|entries| entries.len() as u64)
+      .unwrap_or(0);
+    CompileCacheStats {
+      hits: self.hits.load(Ordering::Relaxed),
+      misses: self.misses.load(Ordering::Relaxed),
+      entries,
+    }
+  }
+
+  pub fn clear(&self) {
+    if let Ok(mut entries) = self.entries.lock() {
+      entries.clear();
+    }
+  }
+}
+
+/// Derive the cache key for an in-memory compilation, or `None` when the input depends on
+/// filesystem state (concrete paths) and must not be cached.
+pub(crate) fn cache_key(
+  config: &CompilerConfig,
+  input: &CompilationInput,
+) -> Result<Option<blake3::Hash>> {
+  let mut hasher = blake3::Hasher::new();
+  hash_config(&mut hasher, config)?;
+
+  match input {
+    CompilationInput::InlineSource { source } => {
+      hasher.update(b"inline");
+      hasher.update(source.as_bytes());
+    }
+    CompilationInput::SourceMap {
+      sources,
+      language_override,
+    } => {
+      hasher.update(b"sources");
+      hasher.update(format!("{:?}", language_override).as_bytes());
+      for (path, source) in sources {
+        hasher.update(path.as_bytes());
+        hasher.update(b"\0");
+        hasher.update(source.as_bytes());
+        hasher.update(b"\0");
+      }
+    }
+    CompilationInput::AstUnits { units } => {
+      hasher.update(b"ast");
+      for (path, unit) in units {
+        hasher.update(path.as_bytes());
+        hasher.update(b"\0");
+        let serialised =
+          map_err_with_context(serde_json::to_vec(unit), "Failed to serialise AST unit")?;
+        hasher.update(&serialised);
+      }
+    }
+    CompilationInput::FilePaths { .. } => return Ok(None),
+  }
+
+  Ok(Some(hasher.finalize()))
+}
+
+fn hash_config(hasher: &mut blake3::Hasher, config: &CompilerConfig) -> Result<()> {
+  hasher.update(format!("{:?}", config.language).as_bytes());
+  hasher.update(config.solc_version.to_string().as_bytes());
+  let settings = map_err_with_context(
+    serde_json::to_vec(&config.solc_settings),
+    "Failed to serialise solc settings",
+  )?;
+  hasher.update(&settings);
+  if config.language == CompilerLanguage::Vyper {
+    hasher.update(format!("{:?}", config.vyper_settings).as_bytes());
+  }
+  for remapping in &config.remappings {
+    hasher.update(remapping.to_string().as_bytes());
+  }
+  Ok(())
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+  use crate::compiler::output::CompileOutput;
+
+  fn inline(source: &str) -> CompilationInput {
+    CompilationInput::InlineSource {
+      source: source.to_string(),
+    }
+  }
+
+  #[test]
+  fn identical_inputs_share_a_key() {
+    let config = CompilerConfig::default();
+    let first = cache_key(&config, &inline("contract A {}")).expect("key");
+    let second = cache_key(&config, &inline("contract A {}")).expect("key");
+    assert_eq!(first, second);
+  }
+
+  #[test]
+  fn source_changes_change_the_key() {
+    let config = CompilerConfig::default();
+    let first = cache_key(&config, &inline("contract A {}")).expect("key");
+    let second = cache_key(&config, &inline("contract B {}")).expect("key");
+    assert_ne!(first, second);
+  }
+
+  #[test]
+  fn solc_version_changes_change_the_key() {
+    let config = CompilerConfig::default();
+    let mut other = CompilerConfig::default();
+    other.solc_version = semver::Version::new(0, 8, 29);
+    let first = cache_key(&config, &inline("contract A {}")).expect("key");
+    let second = cache_key(&other, &inline("contract A {}")).expect("key");
+    assert_ne!(first, second);
+  }
+
+  #[test]
+  fn file_paths_are_never_cached() {
+    let config = CompilerConfig::default();
+    let input = CompilationInput::FilePaths {
+      paths: vec![std::path::PathBuf::from("Example.sol")],
+      language_override: None,
+    };
+    assert!(cache_key(&config, &input).expect("key").is_none());
+  }
+
+  #[test]
+  fn counters_track_hits_and_misses() {
+    let cache = CompileCache::default();
+    let config = CompilerConfig::default();
+    let key = cache_key(&config, &inline("contract A {}"))
+      .expect("key")
+      .expect("cacheable");
+
+    assert!(cache.get(&key).is_none());
+    cache.insert(key, CompileOutput::default());
+    assert!(cache.get(&key).is_some());
+
+    let stats = cache.stats();
+    assert_eq!(stats.hits, 1);
+    assert_eq!(stats.misses, 1);
+    assert_eq!(stats.entries, 1);
+  }
+}
@@ -1,26 +1,37 @@
 use std::collections::{BTreeMap, BTreeSet};
 use std::fs;
 use std::path::{Path, PathBuf};
+use std::sync::Arc;
 
+use foundry_compilers::artifacts::output_selection::OutputSelection;
+use foundry_compilers::artifacts::vyper::VyperSettings;
 use foundry_compilers::artifacts::{
   CompilerOutput, SolcInput, SolcLanguage as FoundrySolcLanguage, Source, Sources,
 };
 use foundry_compilers::compilers::vyper::VyperInput;
 use foundry_compilers::compilers::CompilerOutput as FoundryCompilerOutput;
 use log::{error, info, warn};
+use semver::Version;
 use serde_json::{json, Value};
 
+use super::cache::{self, CompileCache};
+use super::disk_cache::{self, DiskCompileCache};
 use super::input::CompilationInput;
-use super::output::{build_compile_output, from_standard_json, vyper_error_to_core, CompileOutput};
+use super::output::{
+  build_compile_output, from_standard_json, merge_compile_outputs, vyper_error_to_core,
+  CompileOutput,
+};
 use super::project_runner::ProjectRunner;
+use super::shard;
+use super::source_index;
 use crate::internal::config::{
-  CompilerConfig, CompilerConfigOptions, CompilerLanguage, SolcConfig,
+  CompilerConfig, CompilerConfigOptions, CompilerLanguage, ResolvedConfigCache, SolcConfig,
 };
 use crate::internal::errors::{map_err_with_context, Error, Result};
-use crate::internal::project::{
-  create_synthetic_context, FoundryAdapter, HardhatAdapter, ProjectContext,
-};
-use crate::internal::{solc, vyper};
+use crate::internal::metrics;
+use crate::internal::project::{create_synthetic_context, HardhatAdapter, ProjectContext};
+use crate::internal::project_snapshot;
+use crate::internal::{json, solc, solc_pool, vyper};
 
 const LOG_TARGET: &str = "tevm::compiler.core";
 
@@ -28,6 +39,15 @@ const LOG_TARGET: &str = "tevm::compiler.core";
 pub struct State {
   pub config: CompilerConfig,
   pub project: Option<ProjectContext>,
+  /// Shared in-memory compile cache. Clones of the state (e.g. async compile tasks) hand out the
+  /// same cache so repeated inline compilations are answered without touching disk or solc.
+  pub cache: Arc<CompileCache>,
+  /// Persistent binary cache tier consulted when the in-memory cache misses. `None` when caching
+  /// is disabled on the resolved configuration.
+  pub disk_cache: Option<DiskCompileCache>,
+  /// Memo of configurations resolved from per-call overrides. Shared across clones of the state so
+  /// repeated calls with an identical options object skip re-merging and re-sanitising settings.
+  pub resolved_configs: Arc<ResolvedConfigCache>,
 }
 
 #[derive(Clone)]
@@ -88,7 +108,18 @@ pub fn init(config: CompilerConfig, project: Option<ProjectContext>) -> Result<S
   } else if config.language == CompilerLanguage::Vyper {
     info!(target: LOG_TARGET, "using Vyper backend for compilation");
   }
-  Ok(State { config, project })
+  let disk_cache = config.cache_enabled.then(|| {
+    DiskCompileCache::new(disk_cache::cache_dir_for(
+      project.as_ref().map(|context| context.root.as_path()),
+    ))
+  });
+  Ok(State {
+    config,
+    project,
+    cache: Arc::new(CompileCache::default()),
+    disk_cache,
+    resolved_configs: Arc::new(ResolvedConfigCache::default()),
+  })
 }
 
 pub fn init_with_context<F>(config: CompilerConfig, context_loader: F) -> Result<State>
@@ -101,7 +132,7 @@ where
 }
 
 pub fn init_from_foundry_root(config: CompilerConfig, root: &Path) -> Result<State> {
-  init_with_context(config, || FoundryAdapter::load(root))
+  init_with_context(config, || project_snapshot::resolve_foundry(root))
 }
 
 pub fn init_from_hardhat_root(config: CompilerConfig, root: &Path) -> Result<State> {
@@ -117,7 +148,10 @@ pub fn resolve_config(
   state: &State,
   overrides: Option<&CompilerConfigOptions>,
 ) -> Result<CompilerConfig> {
-  state.config.merge_options(overrides).map_err(Error::from)
+  state
+    .resolved_configs
+    .resolve(&state.config, overrides)
+    .map_err(Error::from)
 }
 
 pub fn compile_source(
@@ -153,11 +187,164 @@ pub fn compile_files(
   compile_file_paths(config, paths, language_override)
 }
 
+/// Compile one source against several solc versions concurrently, returning the outputs in the
+/// order the versions were requested. The standard-JSON input is built once and cloned per
+/// version (each clone is still sanitised for its target release), and versions are pulled from a
+/// shared queue by up to `maxParallelJobs` workers, so a multi-version validation sweep costs
+/// roughly as much as its slowest single version instead of the sum of all of them.
+pub fn compile_matrix(
+  config: &CompilerConfig,
+  source: String,
+  versions: Vec<Version>,
+) -> Result<Vec<(Version, CompileOutput)>> {
+  if versions.is_empty() {
+    return Err(Error::new(
+      "compileMatrix requires at least one solc version.",
+    ));
+  }
+  let solc_language = to_solc_language(config.language)?;
+  for version in &versions {
+    solc::ensure_installed(version)?;
+  }
+
+  let virtual_name = match config.language {
+    CompilerLanguage::Solidity => "__VIRTUAL__.sol",
+    CompilerLanguage::Yul => "__VIRTUAL__.yul",
+    CompilerLanguage::Vyper => unreachable!("rejected by to_solc_language"),
+  };
+  let mut sources = Sources::new();
+  sources.insert(PathBuf::from(virtual_name), Source::new(source));
+  let base_input = SolcInput::new(solc_language, sources, config.solc_settings.clone());
+
+  let jobs = effective_parallel_jobs(config).min(versions.len());
+  info!(
+    target: LOG_TARGET,
+    "running solc matrix compilation (versions={}, jobs={})",
+    versions.len(),
+    jobs
+  );
+  let queue = std::sync::Mutex::new(versions.iter().cloned().enumerate().collect::<Vec<_>>());
+  let results: Vec<(usize, Result<CompileOutput>)> = std::thread::scope(|scope| {
+    let base_input = &base_input;
+    let queue = &queue;
+    let mut handles = Vec::with_capacity(jobs);
+    for _ in 0..jobs {
+      handles.push(scope.spawn(move || {
+        let mut outputs = Vec::new();
+        loop {
+          let job = match queue.lock() {
+            Ok(mut pending) => pending.pop(),
+            Err(err) => {
+              outputs.push((
+                usize::MAX,
+                Err(Error::new(format!("Version queue poisoned: {err}"))),
+              ));
+              None
+            }
+          };
+          let Some((index, version)) = job else {
+            break;
+          };
+          outputs.push((index, compile_matrix_version(config, base_input, &version)));
+        }
+        outputs
+      }));
+    }
+    handles
+      .into_iter()
+      .flat_map(|handle| {
+        handle
+          .join()
+          .unwrap_or_else(|_| vec![(usize::MAX, Err(Error::new("Matrix worker thread panicked")))])
+      })
+      .collect()
+  });
+
+  let mut ordered: Vec<Option<CompileOutput>> = vec![None; versions.len()];
+  for (index, result) in results {
+    let output = result?;
+    if index < ordered.len() {
+      ordered[index] = Some(output);
+    }
+  }
+  versions
+    .into_iter()
+    .zip(ordered)
+    .map(|(version, output)| {
+      // An empty slot means the index bookkeeping broke; surfacing it beats handing the caller a
+      // default output that reads as a successful compile for this version.
+      let output = output.ok_or_else(|| {
+        Error::new(format!(
+          "compileMatrix lost the result for version {version}"
+        ))
+      })?;
+      Ok((version, output))
+    })
+    .collect()
+}
+
+fn compile_matrix_version(
+  config: &CompilerConfig,
+  base_input: &SolcInput,
+  version: &Version,
+) -> Result<CompileOutput> {
+  let checkout = solc_pool::checkout(version, config.solc_pool_size)?;
+  let solc = checkout.solc();
+  let mut input = base_input.clone();
+  input.sanitize(&solc.version);
+  let stdout = {
+    let _span = metrics::span(metrics::Phase::SolcExecution);
+    map_err_with_context(solc.compile_output(&input), "Solc compilation failed")?
+  };
+  let output: CompilerOutput =
+    json::from_solc_stdout(stdout, "Failed to parse solc standard-JSON output")?;
+  Ok(from_standard_json(output))
+}
+
 pub fn compile_as(
   state: &State,
   config: &CompilerConfig,
   input: CompilationInput,
 ) -> Result<CompileOutput> {
+  let key = if config.cache_enabled {
+    cache::cache_key(config, &input)?
+  } else {
+    None
+  };
+  if let Some(key) = &key {
+    if let Some(output) = state.cache.get(key) {
+      return Ok(output);
+    }
+    if let Some(disk) = &state.disk_cache {
+      if let Some(output) = disk.get(key) {
+        state.cache.insert(*key, output.clone());
+        return Ok(output);
+      }
+    }
+  }
+
+  let output = compile_as_uncached(state, config, input)?;
+  if let Some(key) = key {
+    if let Some(disk) = &state.disk_cache {
+      disk.insert(&key, &output);
+    }
+    state.cache.insert(key, output.clone());
+  }
+  Ok(output)
+}
+
+fn compile_as_uncached(
+  state: &State,
+  config: &CompilerConfig,
+  input: CompilationInput,
+) -> Result<CompileOutput> {
+  if state.project.is_some() && prefers_sharded_batch(config, &input) {
+    info!(
+      target: LOG_TARGET,
+      "batched source map splits into independent shards; using the work-stealing pipeline"
+    );
+    return compile_pure(config, input);
+  }
   if let Some(context) = &state.project {
     info!(
       target: LOG_TARGET,
@@ -188,8 +375,13 @@ pub fn compile_as(
 }
 
 pub fn compile_project(state: &State, config: &CompilerConfig) -> Result<CompileOutput> {
+  if let Some(result) = source_index::try_incremental(state, config) {
+    return result;
+  }
   let runner = project_runner(state)?;
-  runner.compile_project(config)
+  let output = runner.compile_project(config)?;
+  source_index::record_full_build(state, config, &output);
+  Ok(output)
 }
 
 pub fn compile_contract(
@@ -271,62 +463,277 @@ fn compile_standard_sources(
 ) -> Result<CompileOutput> {
   match language {
     CompilerLanguage::Solidity | CompilerLanguage::Yul => {
-      info!(
-        target: LOG_TARGET,
-        "running solc compilation (language={:?}, sources={})",
-        language,
-        sources.len()
-      );
-      let solc_language = to_solc_language(language)?;
-      let solc_config = SolcConfig {
-        version: config.solc_version.clone(),
-        settings: config.solc_settings.clone(),
-        language: solc_language,
-      };
-      let solc = solc::ensure_installed(&solc_config.version)?;
-      let mut input = SolcInput::new(solc_language, sources, solc_config.settings.clone());
-      input.sanitize(&solc.version);
-      let output: CompilerOutput =
-        map_err_with_context(solc.compile_as(&input), "Solc compilation failed")?;
-      Ok(from_standard_json(output))
+      let shards = shard::partition_sources(&sources);
+      let jobs = effective_parallel_jobs(config).min(shards.len());
+      if shards.len() > 1 && jobs > 1 {
+        info!(
+          target: LOG_TARGET,
+          "running sharded solc compilation (language={:?}, sources={}, shards={}, jobs={})",
+          language,
+          sources.len(),
+          shards.len(),
+          jobs
+        );
+        compile_solc_shards(config, shards, language, jobs)
+      } else {
+        compile_solc_sources(config, sources, language)
+      }
     }
-    CompilerLanguage::Vyper => {
-      info!(
-        target: LOG_TARGET,
-        "running vyper compilation (sources={})",
-        sources.len()
-      );
-      let vyper_compiler = vyper::ensure_installed(config.vyper_settings.path.clone())?;
-      let search_paths = combined_vyper_search_paths(config);
-      let mut settings = config
-        .vyper_settings
-        .to_vyper_settings(search_paths)
-        .map_err(Error::from)?;
-      settings.sanitize(&vyper_compiler.version);
-      let mut input = VyperInput::new(sources, settings, &vyper_compiler.version);
-      input.sanitize(&vyper_compiler.version);
-      let output = map_err_with_context(
-        vyper_compiler.compile_exact(&input),
-        "Vyper compilation failed",
-      )?;
-      let compiler_output = FoundryCompilerOutput::from(output);
-      let raw_artifacts = map_err_with_context(
-        serde_json::to_value(&compiler_output),
-        "Failed to serialise Vyper compiler output",
-      )?;
-      let errors = compiler_output
-        .errors
-        .iter()
-        .map(vyper_error_to_core)
-        .collect();
-      Ok(build_compile_output(
-        &compiler_output.contracts,
-        &compiler_output.sources,
-        raw_artifacts,
-        errors,
-      ))
+    CompilerLanguage::Vyper => compile_vyper_sources(config, sources),
+  }
+}
+
+fn compile_vyper_sources(config: &CompilerConfig, sources: Sources) -> Result<CompileOutput> {
+  let modules = vyper_module_paths(&sources);
+  let jobs = effective_parallel_jobs(config).min(modules.len().max(1));
+  if modules.len() > 1 && jobs > 1 {
+    info!(
+      target: LOG_TARGET,
+      "running per-module vyper compilation (sources={}, modules={}, jobs={})",
+      sources.len(),
+      modules.len(),
+      jobs
+    );
+    compile_vyper_modules(config, &sources, modules, jobs)
+  } else {
+    info!(
+      target: LOG_TARGET,
+      "running vyper compilation (sources={})",
+      sources.len()
+    );
+    compile_vyper_input(config, sources, None)
+  }
+}
+
+/// The sources vyper will emit artifacts for: everything except `.vyi` interface files, which
+/// exist only to be imported.
+fn vyper_module_paths(sources: &Sources) -> Vec<PathBuf> {
+  sources
+    .keys()
+    .filter(|path| path.extension().and_then(|ext| ext.to_str()) != Some("vyi"))
+    .cloned()
+    .collect()
+}
+
+/// Fan the modules across a work-stealing thread pool, one vyper process per module. Unlike solc,
+/// vyper has no parallelism of its own across the files in a standard-JSON input, so a serial
+/// invocation pays for every module back to back; running them concurrently trades one process
+/// spawn per module for wall time bounded by the slowest module.
+fn compile_vyper_modules(
+  config: &CompilerConfig,
+  sources: &Sources,
+  modules: Vec<PathBuf>,
+  jobs: usize,
+) -> Result<CompileOutput> {
+  let queue = std::sync::Mutex::new(modules);
+  let results: Vec<Result<CompileOutput>> = std::thread::scope(|scope| {
+    let mut handles = Vec::with_capacity(jobs);
+    for _ in 0..jobs {
+      handles.push(scope.spawn(|| {
+        let mut outputs = Vec::new();
+        loop {
+          let module = match queue.lock() {
+            Ok(mut pending) => pending.pop(),
+            Err(err) => {
+              outputs.push(Err(Error::new(format!("Module queue poisoned: {err}"))));
+              None
+            }
+          };
+          match module {
+            Some(target) => {
+              outputs.push(compile_vyper_input(config, sources.clone(), Some(&target)))
+            }
+            None => break,
+          }
+        }
+        outputs
+      }));
+    }
+    handles
+      .into_iter()
+      .flat_map(|handle| {
+        handle
+          .join()
+          .unwrap_or_else(|_| vec![Err(Error::new("Module worker thread panicked"))])
+      })
+      .collect()
+  });
+
+  let mut outputs = Vec::with_capacity(results.len());
+  for result in results {
+    outputs.push(result?);
+  }
+  Ok(merge_compile_outputs(outputs))
+}
+
+/// Run one vyper process over `sources`. With a `target`, the output selection is narrowed so
+/// vyper compiles that module alone while the full source set stays available for import
+/// resolution; without one, the whole input is compiled serially.
+fn compile_vyper_input(
+  config: &CompilerConfig,
+  sources: Sources,
+  target: Option<&Path>,
+) -> Result<CompileOutput> {
+  let checkout = vyper::checkout(config.vyper_settings.path.clone(), config.max_parallel_jobs)?;
+  let vyper_compiler = checkout.vyper();
+  let search_paths = combined_vyper_search_paths(config);
+  let mut settings = config
+    .vyper_settings
+    .to_vyper_settings(search_paths)
+    .map_err(Error::from)?;
+  if let Some(target) = target {
+    restrict_vyper_selection(&mut settings, target);
+  }
+  settings.sanitize(&vyper_compiler.version);
+  let mut input = VyperInput::new(sources, settings, &vyper_compiler.version);
+  input.sanitize(&vyper_compiler.version);
+  let output = map_err_with_context(
+    vyper_compiler.compile_exact(&input),
+    "Vyper compilation failed",
+  )?;
+  let compiler_output = FoundryCompilerOutput::from(output);
+  let raw_artifacts = map_err_with_context(
+    serde_json::to_value(&compiler_output),
+    "Failed to serialise Vyper compiler output",
+  )?;
+  let errors = compiler_output
+    .errors
+    .iter()
+    .map(vyper_error_to_core)
+    .collect();
+  Ok(build_compile_output(
+    compiler_output.contracts,
+    &compiler_output.sources,
+    raw_artifacts,
+    errors,
+  ))
+}
+
+/// Replace the output selection with an entry for `target` alone, carrying over whatever was
+/// requested for that file (or for the `*` wildcard when nothing file-specific exists).
+fn restrict_vyper_selection(settings: &mut VyperSettings, target: &Path) {
+  let file_key = target.to_string_lossy().into_owned();
+  let selection = settings
+    .output_selection
+    .0
+    .get(&file_key)
+    .or_else(|| settings.output_selection.0.get("*"))
+    .cloned()
+    .unwrap_or_default();
+  settings.output_selection = OutputSelection(BTreeMap::from([(file_key, selection)]));
+}
+
+fn compile_solc_sources(
+  config: &CompilerConfig,
+  sources: Sources,
+  language: CompilerLanguage,
+) -> Result<CompileOutput> {
+  info!(
+    target: LOG_TARGET,
+    "running solc compilation (language={:?}, sources={})",
+    language,
+    sources.len()
+  );
+  let solc_language = to_solc_language(language)?;
+  let solc_config = SolcConfig {
+    version: config.solc_version.clone(),
+    settings: config.solc_settings.clone(),
+    language: solc_language,
+  };
+  let checkout = solc_pool::checkout(&solc_config.version, config.solc_pool_size)?;
+  let solc = checkout.solc();
+  let mut input = SolcInput::new(solc_language, sources, solc_config.settings.clone());
+  input.sanitize(&solc.version);
+  let stdout = {
+    let _span = metrics::span(metrics::Phase::SolcExecution);
+    map_err_with_context(solc.compile_output(&input), "Solc compilation failed")?
+  };
+  let output: CompilerOutput =
+    json::from_solc_stdout(stdout, "Failed to parse solc standard-JSON output")?;
+  Ok(from_standard_json(output))
+}
+
+/// Drive independent compilation shards through `jobs` worker threads, each pulling work from a
+/// shared queue. The solc pool still bounds how many solc processes run at once globally.
+fn compile_solc_shards(
+  config: &CompilerConfig,
+  shards: Vec<Sources>,
+  language: CompilerLanguage,
+  jobs: usize,
+) -> Result<CompileOutput> {
+  let queue = std::sync::Mutex::new(shards);
+  let results: Vec<Result<CompileOutput>> = std::thread::scope(|scope| {
+    let mut handles = Vec::with_capacity(jobs);
+    for _ in 0..jobs {
+      handles.push(scope.spawn(|| {
+        let mut outputs = Vec::new();
+        loop {
+          let shard = match queue.lock() {
+            Ok(mut pending) => pending.pop(),
+            Err(err) => {
+              outputs.push(Err(Error::new(format!("Shard queue poisoned: {err}"))));
+              None
+            }
+          };
+          match shard {
+            Some(sources) => outputs.push(compile_solc_sources(config, sources, language)),
+            None => break,
+          }
+        }
+        outputs
+      }));
     }
+    handles
+      .into_iter()
+      .flat_map(|handle| {
+        handle
+          .join()
+          .unwrap_or_else(|_| vec![Err(Error::new("Shard worker thread panicked"))])
+      })
+      .collect()
+  });
+
+  let mut outputs = Vec::with_capacity(results.len());
+  for result in results {
+    outputs.push(result?);
+  }
+  Ok(merge_compile_outputs(outputs))
+}
+
+/// Decide whether a source map should bypass the project pipeline in favour of the sharded
+/// standalone one. Materialising a batch as virtual project files hands solc a single monolithic
+/// input, so one slow source serializes everything submitted alongside it; when the map splits
+/// into independent shards and more than one worker is available, fanning the shards across the
+/// work-stealing pool lets small sources finish while large ones are still compiling, and keys the
+/// merged output by the original source names instead of the virtual file paths.
+fn prefers_sharded_batch(config: &CompilerConfig, input: &CompilationInput) -> bool {
+  let CompilationInput::SourceMap {
+    sources,
+    language_override,
+  } = input
+  else {
+    return false;
+  };
+  let language = language_override.unwrap_or(config.language);
+  if !language.is_solc_language() || sources.len() < 2 || effective_parallel_jobs(config) < 2 {
+    return false;
   }
+  let solc_sources: Sources = sources
+    .iter()
+    .map(|(path, content)| (PathBuf::from(path), Source::new(content.clone())))
+    .collect();
+  shard::partition_sources(&solc_sources).len() > 1
+}
+
+fn effective_parallel_jobs(config: &CompilerConfig) -> usize {
+  config
+    .max_parallel_jobs
+    .unwrap_or_else(|| {
+      std::thread::available_parallelism()
+        .map(|parallelism| parallelism.get())
+        .unwrap_or(1)
+    })
+    .max(1)
 }
 
 fn compile_ast_sources(
@@ -344,7 +751,8 @@ fn compile_ast_sources(
     settings: config.solc_settings.clone(),
     language: FoundrySolcLanguage::Solidity,
   };
-  let solc = solc::ensure_installed(&solc_config.version)?;
+  let checkout = solc_pool::checkout(&solc_config.version, config.solc_pool_size)?;
+  let solc = checkout.solc();
   let settings_value = map_err_with_context(
     serde_json::to_value(&solc_config.settings),
     "Failed to serialize settings",
@@ -361,8 +769,12 @@ fn compile_ast_sources(
     "settings": settings_value
   });
 
+  let stdout = {
+    let _span = metrics::span(metrics::Phase::SolcExecution);
+    map_err_with_context(solc.compile_output(&input), "Solc compilation failed")?
+  };
   let output: CompilerOutput =
-    map_err_with_context(solc.compile_as(&input), "Solc compilation failed")?;
+    json::from_solc_stdout(stdout, "Failed to parse solc standard-JSON output")?;
   Ok(from_standard_json(output))
 }
 
@@ -700,6 +1112,102 @@ mod tests {
       .contains("compileSources does not support mixing inline source strings with AST entries"));
   }
 
+  fn source_map_input(entries: &[(&str, &str)]) -> CompilationInput {
+    CompilationInput::SourceMap {
+      sources: entries
+        .iter()
+        .map(|(path, content)| (path.to_string(), content.to_string()))
+        .collect(),
+      language_override: None,
+    }
+  }
+
+  #[test]
+  fn independent_source_maps_prefer_the_sharded_batch_pipeline() {
+    let mut config = CompilerConfig::default();
+    config.max_parallel_jobs = Some(4);
+    let input = source_map_input(&[("A.sol", "contract A {}"), ("B.sol", "contract B {}")]);
+    assert!(prefers_sharded_batch(&config, &input));
+  }
+
+  #[test]
+  fn entangled_or_serial_source_maps_stay_on_the_project_pipeline() {
+    let mut config = CompilerConfig::default();
+    config.max_parallel_jobs = Some(4);
+    let entangled = source_map_input(&[
+      ("A.sol", "import \"./B.sol\";\ncontract A {}"),
+      ("B.sol", "contract B {}"),
+    ]);
+    assert!(!prefers_sharded_batch(&config, &entangled));
+
+    let single = source_map_input(&[("A.sol", "contract A {}")]);
+    assert!(!prefers_sharded_batch(&config, &single));
+
+    let mut serial_config = CompilerConfig::default();
+    serial_config.max_parallel_jobs = Some(1);
+    let independent = source_map_input(&[("A.sol", "contract A {}"), ("B.sol", "contract B {}")]);
+    assert!(!prefers_sharded_batch(&serial_config, &independent));
+  }
+
+  #[test]
+  fn compile_matrix_requires_versions() {
+    let config = CompilerConfig::default();
+    let error = compile_matrix(&config, "contract A {}".to_string(), Vec::new()).unwrap_err();
+    assert!(error
+      .to_string()
+      .contains("compileMatrix requires at least one solc version"));
+  }
+
+  #[test]
+  fn compile_matrix_rejects_vyper_language() {
+    let mut config = CompilerConfig::default();
+    config.language = CompilerLanguage::Vyper;
+    let error = compile_matrix(
+      &config,
+      "@external\ndef foo():\n  pass".to_string(),
+      vec![Version::new(0, 8, 30)],
+    )
+    .unwrap_err();
+    assert!(error
+      .to_string()
+      .contains("Vyper sources must be compiled with the Vyper compiler"));
+  }
+
+  #[test]
+  fn vyper_module_paths_skips_interface_files() {
+    let mut sources = Sources::new();
+    sources.insert(PathBuf::from("Counter.vy"), Source::new("def foo(): pass"));
+    sources.insert(PathBuf::from("ICounter.vyi"), Source::new("def foo(): ..."));
+    sources.insert(PathBuf::from("Vault.vy"), Source::new("def bar(): pass"));
+    let modules = vyper_module_paths(&sources);
+    assert_eq!(
+      modules,
+      vec![PathBuf::from("Counter.vy"), PathBuf::from("Vault.vy")]
+    );
+  }
+
+  #[test]
+  fn restrict_vyper_selection_narrows_to_the_target_module() {
+    let mut settings = VyperSettings {
+      output_selection: OutputSelection(BTreeMap::from([(
+        "*".to_string(),
+        BTreeMap::from([("*".to_string(), vec!["abi".to_string(), "evm".to_string()])]),
+      )])),
+      ..VyperSettings::default()
+    };
+    restrict_vyper_selection(&mut settings, Path::new("Counter.vy"));
+    assert_eq!(settings.output_selection.0.len(), 1);
+    let selection = settings
+      .output_selection
+      .0
+      .get("Counter.vy")
+      .expect("target entry");
+    assert_eq!(
+      selection.get("*").expect("wildcard contracts"),
+      &vec!["abi".to_string(), "evm".to_string()]
+    );
+  }
+
   #[test]
   fn compile_vyper_source() {
     let mut config = CompilerConfig::default();
@@ -0,0 +1,152 @@
+use std::fs;
+use std::path::{Path, PathBuf};
+
+use log::{debug, warn};
+
+use super::output::CompileOutput;
+use crate::internal::metrics;
+
+const LOG_TARGET: &str = "tevm::compiler.cache.disk";
+
+/// Magic prefix identifying the binary cache format. The trailing digits are the format version:
+/// bump them whenever the serialized layout of [`CompileOutput`] changes so stale entries from
+/// older builds read as misses instead of corrupt data.
+const MAGIC: &[u8; 8] = b"TEVMBC02";
+
+/// Persistent binary tier below the in-memory [`CompileCache`](super::cache::CompileCache).
+/// Entries are MessagePack-encoded `CompileOutput` snapshots stored per cache key and read back
+/// through a memory mapping, so a warm process start skips Foundry's JSON artifact re-parse and a
+/// fully-cached compile is served straight from the page cache.
+#[derive(Clone, Debug)]
+pub struct DiskCompileCache {
+  dir: PathBuf,
+}
+
+impl DiskCompileCache {
+  pub fn new(dir: PathBuf) -> Self {
+    Self { dir }
+  }
+
+  fn entry_path(&self, key: &blake3::Hash) -> PathBuf {
+    self.dir.join(format!("{}.bin", key.to_hex()))
+  }
+
+  /// Loads the entry for `key`, or `None` when absent. Unreadable or version-mismatched entries
+  /// are removed and treated as misses — the cache is an optimisation, never an error source.
+  pub fn get(&self, key: &blake3::Hash) -> Option<CompileOutput> {
+    let output = self.lookup(key);
+    metrics::record_disk_cache(output.is_some());
+    output
+  }
+
+  fn lookup(&self, key: &blake3::Hash) -> Option<CompileOutput> {
+    let path = self.entry_path(key);
+    let file = fs::File::open(&path).ok()?;
+    // SAFETY: the mapping is read-only and private to this lookup; a concurrent writer replaces
+    // entries atomically via rename, so the mapped file is never mutated in place.
+    let map = unsafe { memmap2::Mmap::map(&file) }.ok()?;
+    match decode(&map) {
+      Some(output) => {
+        debug!(
+          target: LOG_TARGET,
+          "disk cache hit (key={})",
+          key.to_hex()
+        );
+        Some(output)
+      }
+      None => {
+        warn!(
+          target: LOG_TARGET,
+          "discarding unreadable disk cache entry {}",
+          path.display()
+        );
+        let _ = fs::remove_file(&path);
+        None
+      }
+    }
+  }
+
+  /// Persists `output` under `key`. Failures are logged and swallowed; the caller already has the
+  /// freshly compiled output in hand.
+  pub fn insert(&self, key: &blake3::Hash, output: &CompileOutput) {
+    if let Err(err) = self.try_insert(key, output) {
+      warn!(
+        target: LOG_TARGET,
+        "failed to persist disk cache entry {}: {err}",
+        key.to_hex()
+      );
+    }
+  }
+
+  fn try_insert(&self, key: &blake3::Hash, output: &CompileOutput) -> std::io::Result<()> {
+    fs::create_dir_all(&self.dir)?;
+    let mut payload = Vec::with_capacity(MAGIC.len() + 1024);
+    payload.extend_from_slice(MAGIC);
+    rmp_serde::encode::write(&mut payload, output)
+      .map_err(|err| std::io::Error::other(err.to_string()))?;
+
+    // Write-then-rename keeps concurrent readers from ever mapping a half-written entry.
+    let path = self.entry_path(key);
+    let staging = self
+      .dir
+      .join(format!("{}.tmp-{}", key.to_hex(), std::process::id()));
+    fs::write(&staging, &payload)?;
+    fs::rename(&staging, &path)
+  }
+}
+
+fn decode(bytes: &[u8]) -> Option<CompileOutput> {
+  let payload = bytes.strip_prefix(MAGIC)?;
+  rmp_serde::from_slice(payload).ok()
+}
+
+/// Resolves the binary cache directory for a compiler state: project-bound compilers share the
+/// project's `.tevm` workspace, inline compilers fall back to the default cache dir.
+pub(crate) fn cache_dir_for(root: Option<&Path>) -> PathBuf {
+  match root {
+    Some(root) => root.join(".tevm").join("compile-cache"),
+    None => crate::internal::project::default_cache_dir()
+      .join(".tevm")
+      .join("compile-cache"),
+  }
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+
+  fn sample_key(data: &str) -> blake3::Hash {
+    blake3::hash(data.as_bytes())
+  }
+
+  #[test]
+  fn round_trips_outputs_through_the_binary_format() {
+    let dir = tempfile::tempdir().expect("tempdir");
+    let cache = DiskCompileCache::new(dir.path().to_path_buf());
+    let key = sample_key("contract A {}");
+
+    assert!(cache.get(&key).is_none());
+
+    let mut output = CompileOutput::default();
+    output.raw_artifacts = serde_json::json!({ "contracts": { "A.sol": {} } });
+    cache.insert(&key, &output);
+
+    let loaded = cache.get(&key).expect("disk hit");
+    assert_eq!(loaded.raw_artifacts, output.raw_artifacts);
+    assert!(loaded.errors.is_empty());
+  }
+
+  #[test]
+  fn version_mismatched_entries_read_as_misses_and_are_removed() {
+    let dir = tempfile::tempdir().expect("tempdir");
+    let cache = DiskCompileCache::new(dir.path().to_path_buf());
+    let key = sample_key("contract B {}");
+
+    std::fs::create_dir_all(dir.path()).expect("dir");
+    let path = dir.path().join(format!("{}.bin", key.to_hex()));
+    std::fs::write(&path, b"TEVMBC00junk").expect("write stale entry");
+
+    assert!(cache.get(&key).is_none());
+    assert!(!path.exists(), "stale entry should be discarded");
+  }
+}
@@ -4,7 +4,8 @@ use std::time::Instant;
 
 use log::{error, info};
 use napi::bindgen_prelude::*;
-use napi::{Env, JsObject, JsUnknown};
+use napi::threadsafe_function::{ErrorStrategy, ThreadsafeFunction};
+use napi::{Env, JsFunction, JsObject, JsUnknown};
 use serde_json::Value;
 
 use crate::ast::utils::from_js_value;
@@ -13,21 +14,32 @@ use crate::internal::config::{
 };
 use crate::internal::errors::{napi_error, to_napi_result, Error, Result};
 use crate::internal::logging::{ensure_napi_logger, ensure_rust_logger, update_level};
+use crate::internal::metrics;
 use crate::internal::path::ProjectPaths;
 use crate::internal::project::{default_cache_dir, synthetic_project_paths, ProjectContext};
+use crate::internal::project_snapshot;
 use crate::internal::solc;
+pub use cache::CompileCacheStats;
 pub use core::{
-  compile_contract, compile_files, compile_project, compile_source, compile_sources, init,
-  init_from_foundry_root, init_from_hardhat_root, init_from_root, resolve_config, SourceTarget,
-  SourceValue, State,
+  compile_contract, compile_files, compile_matrix, compile_project, compile_source,
+  compile_sources, init, init_from_foundry_root, init_from_hardhat_root, init_from_root,
+  resolve_config, SourceTarget, SourceValue, State,
 };
 pub use input::CompilationInput;
-use output::{into_js_compile_output, CompileOutput, JsCompileOutput};
+use output::{into_js_compile_output, CompileOutput, JsCompileOutput, JsProjectStreamEntry};
+pub use tasks::{CompileTask, ProjectStreamTask};
+pub use watcher::JsCompilerWatcher;
 
+mod cache;
 pub mod core;
+mod disk_cache;
 mod input;
 pub mod output;
 mod project_runner;
+mod shard;
+mod source_index;
+mod tasks;
+mod watcher;
 
 const LOG_TARGET: &str = "tevm::compiler";
 
@@ -579,6 +591,23 @@ impl Compiler {
     }
   }
 
+  /// Snapshot the in-memory compile cache counters (hits, misses, and resident entries).
+  pub fn cache_stats(&self) -> CompileCacheStats {
+    self.state.cache.stats()
+  }
+
+  /// Drop every entry from the in-memory compile cache. Counters are preserved.
+  pub fn clear_cache(&self) {
+    self.state.cache.clear()
+  }
+
+  /// Drop the cached project resolution (remappings, import paths, path config) so the next
+  /// `from_foundry_root` call re-resolves from scratch. Scoped to the attached project's root when
+  /// one exists, otherwise every root resolved by this process is invalidated.
+  pub fn invalidate_resolution_cache(&self) {
+    project_snapshot::invalidate(self.project().map(|context| context.root.as_path()))
+  }
+
   /// Consume the compiler and return the internal state for advanced workflows.
   pub fn into_state(self) -> State {
     self.state
@@ -805,6 +834,42 @@ impl JsCompiler {
     Ok(into_js_compile_output(output))
   }
 
+  /// Compile one source against several solc versions concurrently. The standard-JSON
+  /// input is serialised once and dispatched to every requested version in parallel, so
+  /// validating a library against a range of releases costs roughly as much as the
+  /// slowest single version. Returns outputs keyed by the requested version strings.
+  #[napi(
+    ts_args_type = "source: string, versions: ReadonlyArray<string>, options?: CompilerConfigOptions | undefined",
+    ts_return_type = "Record<string, CompileOutput<true, undefined> | CompileOutput<false, undefined>>"
+  )]
+  pub fn compile_matrix(
+    &self,
+    env: Env,
+    source: String,
+    versions: Vec<String>,
+    options: Option<JsUnknown>,
+  ) -> napi::Result<std::collections::HashMap<String, JsCompileOutput>> {
+    let parsed_versions = versions
+      .iter()
+      .map(|version| {
+        semver::Version::parse(version.trim().trim_start_matches('v')).map_err(|err| {
+          napi_error(format!(
+            "Invalid solc version \"{version}\" passed to compileMatrix: {err}"
+          ))
+        })
+      })
+      .collect::<napi::Result<Vec<_>>>()?;
+    let config = self.parse_call_config(&env, options)?;
+    let outputs = to_napi_result(compile_matrix(&config, source, parsed_versions))?;
+    Ok(
+      versions
+        .into_iter()
+        .zip(outputs)
+        .map(|(version, (_, output))| (version, into_js_compile_output(output)))
+        .collect(),
+    )
+  }
+
   /// Compile the project associated with this compiler instance, returning a snapshot
   /// covering every source file that emitted artifacts.
   #[napi(
@@ -847,12 +912,226 @@ impl JsCompiler {
     Ok(into_js_compile_output(output))
   }
 
+  /// Compile inline source text or an in-memory Solidity AST on a worker thread.
+  /// Behaves exactly like `compileSource` but returns a promise and never blocks
+  /// the event loop while solc runs.
+  #[napi(
+    ts_args_type = "target: string | object, options?: CompilerConfigOptions | undefined",
+    ts_return_type = "Promise<CompileOutput<true, undefined> | CompileOutput<false, undefined>>"
+  )]
+  pub fn compile_source_async(
+    &self,
+    env: Env,
+    target: Either<String, JsObject>,
+    options: Option<JsUnknown>,
+  ) -> napi::Result<AsyncTask<CompileTask>> {
+    let config = self.parse_call_config(&env, options)?;
+    let target = parse_source_target(&env, target)?;
+    Ok(tasks::compile_async(
+      self.inner.state.clone(),
+      config,
+      tasks::CompileRequest::Source { target },
+    ))
+  }
+
+  /// Compile a keyed map of sources or AST entries on a worker thread. The async
+  /// counterpart of `compileSources`.
+  #[napi(
+    ts_generic_types = "TSources extends Record<string, string | object> = Record<string, string | object>",
+    ts_args_type = "sources: TSources, options?: CompilerConfigOptions | undefined",
+    ts_return_type = "Promise<CompileOutput<true, Extract<keyof TSources, string>[]> | CompileOutput<false, Extract<keyof TSources, string>[]>>"
+  )]
+  pub fn compile_sources_async(
+    &self,
+    env: Env,
+    sources: JsObject,
+    options: Option<JsUnknown>,
+  ) -> napi::Result<AsyncTask<CompileTask>> {
+    let config = self.parse_call_config(&env, options)?;
+    let map = Self::parse_sources_object(&env, sources)?;
+    Ok(tasks::compile_async(
+      self.inner.state.clone(),
+      config,
+      tasks::CompileRequest::Sources { sources: map },
+    ))
+  }
+
+  /// Compile concrete files on disk on a worker thread. The async counterpart of
+  /// `compileFiles`.
+  #[napi(
+    ts_generic_types = "TFilePaths extends readonly string[] = readonly string[]",
+    ts_args_type = "paths: TFilePaths, options?: CompilerConfigOptions | undefined",
+    ts_return_type = "Promise<CompileOutput<true, TFilePaths> | CompileOutput<false, TFilePaths>>"
+  )]
+  pub fn compile_files_async(
+    &self,
+    env: Env,
+    paths: Vec<String>,
+    options: Option<JsUnknown>,
+  ) -> napi::Result<AsyncTask<CompileTask>> {
+    if paths.is_empty() {
+      return Err(napi_error("compileFiles requires at least one path."));
+    }
+    let parsed = parse_js_compiler_config(&env, options)?;
+    let overrides = parsed
+      .as_ref()
+      .map(|opts| CompilerConfigOptions::try_from(opts))
+      .transpose()?;
+    let config = self.resolve_call_config(overrides.as_ref())?;
+    let language_override = language_override(overrides.as_ref());
+    let path_bufs = paths.into_iter().map(PathBuf::from).collect();
+    Ok(tasks::compile_async(
+      self.inner.state.clone(),
+      config,
+      tasks::CompileRequest::Files {
+        paths: path_bufs,
+        language_override,
+      },
+    ))
+  }
+
+  /// Compile the attached project on a worker thread. The async counterpart of
+  /// `compileProject`, allowing several project builds to run concurrently.
+  #[napi(
+    ts_args_type = "options?: CompilerConfigOptions | undefined",
+    ts_return_type = "Promise<CompileOutput<true, string[]> | CompileOutput<false, string[]>>"
+  )]
+  pub fn compile_project_async(
+    &self,
+    env: Env,
+    options: Option<JsUnknown>,
+  ) -> napi::Result<AsyncTask<CompileTask>> {
+    let config = self.parse_call_config(&env, options)?;
+    Ok(tasks::compile_async(
+      self.inner.state.clone(),
+      config,
+      tasks::CompileRequest::Project,
+    ))
+  }
+
+  /// Stream contract-level results from a project compile. `onContract` fires as each
+  /// contract is detached from the compiler output, so callers can start processing
+  /// the first artifacts before the rest of the build has been converted; the returned
+  /// promise resolves with the full diagnostic list once the stream is exhausted.
+  #[napi(
+    ts_args_type = "onContract: (entry: ProjectStreamEntry) => void, options?: CompilerConfigOptions | undefined",
+    ts_return_type = "Promise<ReadonlyArray<CompilerError>>"
+  )]
+  pub fn compile_project_stream(
+    &self,
+    env: Env,
+    on_contract: JsFunction,
+    options: Option<JsUnknown>,
+  ) -> napi::Result<AsyncTask<ProjectStreamTask>> {
+    let config = self.parse_call_config(&env, options)?;
+    let sink: ThreadsafeFunction<JsProjectStreamEntry, ErrorStrategy::Fatal> =
+      on_contract.create_threadsafe_function(0, |ctx| Ok(vec![ctx.value]))?;
+    Ok(tasks::compile_project_stream(
+      self.inner.state.clone(),
+      config,
+      sink,
+    ))
+  }
+
+  /// Compile a single contract by canonical name on a worker thread. The async
+  /// counterpart of `compileContract`.
+  #[napi(
+    ts_args_type = "contractName: string, options?: CompilerConfigOptions | undefined",
+    ts_return_type = "Promise<CompileOutput<true, undefined> | CompileOutput<false, undefined>>"
+  )]
+  pub fn compile_contract_async(
+    &self,
+    env: Env,
+    contract_name: String,
+    options: Option<JsUnknown>,
+  ) -> napi::Result<AsyncTask<CompileTask>> {
+    let config = self.parse_call_config(&env, options)?;
+    Ok(tasks::compile_async(
+      self.inner.state.clone(),
+      config,
+      tasks::CompileRequest::Contract { contract_name },
+    ))
+  }
+
   /// Return the canonicalised project paths used for artifacts, cache directories,
   /// and virtual source storage.
   #[napi]
   pub fn get_paths(&self) -> napi::Result<ProjectPaths> {
     to_napi_result(self.inner.get_paths())
   }
+
+  /// Snapshot the in-memory compile cache counters. Hits are answered without touching
+  /// the filesystem or spawning solc; misses fall through to a full compilation.
+  #[napi]
+  pub fn get_cache_stats(&self) -> JsCompileCacheStats {
+    let stats = self.inner.cache_stats();
+    JsCompileCacheStats {
+      hits: stats.hits as i64,
+      misses: stats.misses as i64,
+      entries: stats.entries as i64,
+    }
+  }
+
+  /// Evict every entry from the in-memory compile cache while preserving the counters.
+  #[napi]
+  pub fn clear_cache(&self) {
+    self.inner.clear_cache()
+  }
+
+  /// Drop the cached project resolution shared across compilers created from the same root, so
+  /// the next `fromFoundryRoot` call re-resolves remappings and import paths from scratch. Use
+  /// after installing or removing dependencies under `lib/` or `node_modules` without touching
+  /// `foundry.toml` or `remappings.txt` (edits to those files invalidate automatically).
+  #[napi]
+  pub fn invalidate_resolution_cache(&self) {
+    self.inner.invalidate_resolution_cache()
+  }
+
+  /// Snapshot the pipeline timing spans and cache hit rates. Phase timings and the disk cache
+  /// counters are process-wide (they aggregate across compiler instances and worker threads);
+  /// the memory cache counters belong to this instance. Useful for attributing a slow build to
+  /// solc itself versus JSON parsing, output conversion, project resolution, or AST work.
+  #[napi(ts_return_type = "CompilerMetrics")]
+  pub fn get_metrics(&self) -> metrics::JsCompilerMetrics {
+    let stats = self.inner.cache_stats();
+    metrics::snapshot(stats.hits, stats.misses)
+  }
+
+  /// Create a long-lived watcher over the attached project's source and library directories.
+  /// The watcher keeps the import graph in memory and recompiles only the dirty transitive
+  /// closure on each change, so saves feed back in well under a full project build.
+  #[napi(
+    ts_args_type = "pollIntervalMs?: number | undefined",
+    ts_return_type = "CompilerWatcher"
+  )]
+  pub fn create_watcher(
+    &self,
+    poll_interval_ms: Option<u32>,
+  ) -> napi::Result<watcher::JsCompilerWatcher> {
+    let context = self.inner.project().ok_or_else(|| {
+      napi_error(
+        "createWatcher requires a project-bound compiler. Construct one with Compiler.fromFoundryRoot, Compiler.fromHardhatRoot, or Compiler.fromRoot.",
+      )
+    })?;
+    let config = self.resolve_call_config(None)?;
+    to_napi_result(watcher::JsCompilerWatcher::create(
+      context,
+      config,
+      poll_interval_ms,
+    ))
+  }
+}
+
+/// Counter snapshot returned by `Compiler.getCacheStats`.
+#[napi(object, js_name = "CompileCacheStats")]
+#[derive(Clone, Copy, Debug)]
+pub struct JsCompileCacheStats {
+  /// Number of compilations answered from the in-memory cache.
+  pub hits: i64,
+  /// Number of cache lookups that fell through to a full compilation.
+  pub misses: i64,
+  /// Number of finished outputs currently resident in the cache.
+  pub entries: i64,
 }
 
 impl JsCompiler {
@@ -863,6 +1142,21 @@ impl JsCompiler {
     to_napi_result(resolve_config(&self.inner.state, overrides))
   }
 
+  /// Parse per-call JS options and merge them into a resolved configuration. Used by the async
+  /// compile entry points, which must finish all N-API work before handing off to a worker thread.
+  fn parse_call_config(
+    &self,
+    env: &Env,
+    options: Option<JsUnknown>,
+  ) -> napi::Result<CompilerConfig> {
+    let parsed = parse_js_compiler_config(env, options)?;
+    let overrides = parsed
+      .as_ref()
+      .map(|opts| CompilerConfigOptions::try_from(opts))
+      .transpose()?;
+    self.resolve_call_config(overrides.as_ref())
+  }
+
   fn parse_sources_object(
     env: &Env,
     sources: JsObject,
@@ -1,6 +1,7 @@
 use std::collections::{BTreeMap, HashMap};
 use std::convert::TryFrom;
 use std::path::PathBuf;
+use std::sync::{Arc, OnceLock};
 
 use foundry_compilers::artifacts::contract::Contract as FoundryContract;
 use foundry_compilers::artifacts::{
@@ -26,6 +27,9 @@ use crate::contract;
 use crate::contract::{Contract, JsContract, JsContractState};
 use crate::internal::config::AstConfigOptions;
 use crate::internal::errors::napi_error;
+use crate::internal::intern::StringInterner;
+use crate::internal::metrics;
+use crate::internal::napi_ser;
 
 // -----------------------------------------------------------------------------
 // Shared error and location types
@@ -182,10 +186,11 @@ pub struct CompilerError {
 /// Contracts and metadata emitted for a single source file. This struct is the Rust counterpart of
 /// `SourceArtifactsJson` and feeds both the JSON snapshot and the N-API bindings. Consumers can
 /// inspect the resolved AST, solc version, and the per-contract wrappers associated with the file.
-#[derive(Clone, Debug, Default)]
+#[derive(Clone, Debug, Default, Serialize, Deserialize)]
 pub struct SourceArtifacts {
-  /// Canonicalised path associated with this source, when known.
-  pub source_path: Option<String>,
+  /// Canonicalised path associated with this source, when known. Interned so the map key, this
+  /// field, and every per-contract `sourcePath` share one allocation.
+  pub source_path: Option<Arc<str>>,
   /// Numeric source identifier assigned by solc.
   pub source_id: Option<u32>,
   /// Solc version that produced these artifacts.
@@ -194,12 +199,12 @@ pub struct SourceArtifacts {
   pub ast: Option<Value>,
   /// Contracts emitted for this source keyed by contract name. Each entry is the rich wrapper used
   /// elsewhere in the bindings (ABI, bytecode, metadata, etc.).
-  pub contracts: BTreeMap<String, Contract>,
+  pub contracts: BTreeMap<Arc<str>, Contract>,
 }
 
 impl SourceArtifacts {
   /// Create a new artifacts bundle keyed by an optional source path.
-  fn new(source_path: Option<String>) -> Self {
+  fn new(source_path: Option<Arc<str>>) -> Self {
     Self {
       source_path,
       ..Default::default()
@@ -249,14 +254,14 @@ impl SourceArtifactsJson {
           .iter()
           .map(|(name, contract)| {
             let snapshot = contract::contract_state_to_js(contract.state());
-            (name.clone(), snapshot)
+            (name.to_string(), snapshot)
           })
           .collect(),
       )
     };
 
     Self {
-      source_path: artifacts.source_path.clone(),
+      source_path: artifacts.source_path.as_deref().map(str::to_string),
       source_id: artifacts.source_id,
       solc_version: artifacts
         .solc_version
@@ -270,14 +275,15 @@ impl SourceArtifactsJson {
 
 /// Aggregate result returned by compilation requests. This mirrors Foundry's aggregated output but
 /// collapses the multi-version map into a simpler one-to-one mapping keyed by canonical source path.
-#[derive(Clone, Debug)]
+#[derive(Clone, Debug, Default, Serialize, Deserialize)]
 pub struct CompileOutput {
   /// Raw aggregated artifact tree mirroring Foundry's standard JSON output (`contracts`, `sources`,
   /// `errors`). Useful when you need to feed the data back into a tool that expects the canonical
   /// Foundry JSON schema.
   pub raw_artifacts: Value,
-  /// Artifacts grouped by canonical source path.
-  pub artifacts: BTreeMap<String, SourceArtifacts>,
+  /// Artifacts grouped by canonical source path. Keys are interned alongside the per-source and
+  /// per-contract path fields, so long monorepo paths are stored once per output.
+  pub artifacts: BTreeMap<Arc<str>, SourceArtifacts>,
   /// Convenience handle to the sole artifact when only one source produced output.
   pub artifact: Option<SourceArtifacts>,
   /// All diagnostics produced during compilation across every severity level.
@@ -329,7 +335,7 @@ impl CompileOutputJson {
         output
           .artifacts
           .iter()
-          .map(|(path, artifacts)| (path.clone(), artifacts.to_json()))
+          .map(|(path, artifacts)| (path.to_string(), artifacts.to_json()))
           .collect(),
       )
     };
@@ -354,6 +360,7 @@ impl CompileOutputJson {
 }
 
 pub fn into_core_compile_output(output: ProjectCompileOutput<MultiCompiler>) -> CompileOutput {
+  let _span = metrics::span(metrics::Phase::OutputConversion);
   let artifacts = collate_project_artifacts(&output);
   let artifact = artifacts
     .values()
@@ -374,13 +381,14 @@ pub fn into_core_compile_output(output: ProjectCompileOutput<MultiCompiler>) ->
 }
 
 pub fn from_standard_json(output: CompilerOutput) -> CompileOutput {
+  let _span = metrics::span(metrics::Phase::OutputConversion);
   let raw_artifacts = serde_json::to_value(&output).unwrap_or(Value::Null);
   let errors = output
     .errors
     .iter()
     .map(|error: &FoundryCompilerError| solc_error_to_core(error))
     .collect();
-  build_compile_output(&output.contracts, &output.sources, raw_artifacts, errors)
+  build_compile_output(output.contracts, &output.sources, raw_artifacts, errors)
 }
 
 fn convert_source_ast(source: &SourceFile) -> Option<Value> {
@@ -457,31 +465,33 @@ fn multi_error_to_core(error: &MultiCompilerError) -> CompilerError {
 }
 
 pub(crate) fn build_compile_output(
-  contracts: &FileToContractsMap<FoundryContract>,
+  contracts: FileToContractsMap<FoundryContract>,
   sources: &BTreeMap<PathBuf, SourceFile>,
   raw_artifacts: Value,
   errors: Vec<CompilerError>,
 ) -> CompileOutput {
-  let mut artifacts: BTreeMap<String, SourceArtifacts> = BTreeMap::new();
+  let mut interner = StringInterner::new();
+  let mut artifacts: BTreeMap<Arc<str>, SourceArtifacts> = BTreeMap::new();
 
   for (path, contract_map) in contracts {
-    let key = path.to_string_lossy().to_string();
+    let key = interner.intern(&path.to_string_lossy());
     let entry = artifacts
-      .entry(key.clone())
-      .or_insert_with(|| SourceArtifacts::new(Some(key.clone())));
+      .entry(Arc::clone(&key))
+      .or_insert_with(|| SourceArtifacts::new(Some(Arc::clone(&key))));
 
     for (name, foundry_contract) in contract_map {
-      let mut core = Contract::from_foundry_standard_json(name.clone(), foundry_contract);
-      core.state_mut().source_path = Some(key.clone());
-      entry.contracts.insert(name.clone(), core);
+      let name = interner.intern(&name);
+      let mut core = Contract::from_foundry_standard_json(Arc::clone(&name), foundry_contract);
+      core.state_mut().source_path = Some(Arc::clone(&key));
+      entry.contracts.insert(name, core);
     }
   }
 
   for (path, source) in sources {
-    let key = path.to_string_lossy().to_string();
+    let key = interner.intern(&path.to_string_lossy());
     let entry = artifacts
-      .entry(key.clone())
-      .or_insert_with(|| SourceArtifacts::new(Some(key.clone())));
+      .entry(Arc::clone(&key))
+      .or_insert_with(|| SourceArtifacts::new(Some(key)));
     entry.source_id = Some(source.id);
     entry.ast = convert_source_ast(source);
   }
@@ -500,6 +510,59 @@ pub(crate) fn build_compile_output(
   }
 }
 
+/// Fold the outputs of independently compiled shards back into a single snapshot. Artifacts and
+/// diagnostics are unioned by canonical source path; the raw standard-JSON trees are merged
+/// object-by-object so the result still mirrors what one combined solc run would have produced.
+/// Per-shard source ids are kept as-is since diagnostics reference sources by path, not id.
+pub(crate) fn merge_compile_outputs(outputs: Vec<CompileOutput>) -> CompileOutput {
+  let mut outputs = outputs;
+  if outputs.len() == 1 {
+    return outputs.remove(0);
+  }
+
+  let mut raw_contracts = Map::new();
+  let mut raw_sources = Map::new();
+  let mut raw_errors = Vec::new();
+  let mut artifacts: BTreeMap<Arc<str>, SourceArtifacts> = BTreeMap::new();
+  let mut errors = Vec::new();
+
+  for output in outputs {
+    if let Value::Object(mut raw) = output.raw_artifacts {
+      if let Some(Value::Object(contracts)) = raw.remove("contracts") {
+        raw_contracts.extend(contracts);
+      }
+      if let Some(Value::Object(sources)) = raw.remove("sources") {
+        raw_sources.extend(sources);
+      }
+      if let Some(Value::Array(shard_errors)) = raw.remove("errors") {
+        raw_errors.extend(shard_errors);
+      }
+    }
+    artifacts.extend(output.artifacts);
+    errors.extend(output.errors);
+  }
+
+  let artifact = artifacts
+    .values()
+    .next()
+    .cloned()
+    .filter(|_| artifacts.len() == 1);
+
+  let mut raw = Map::new();
+  raw.insert("contracts".to_string(), Value::Object(raw_contracts));
+  raw.insert("sources".to_string(), Value::Object(raw_sources));
+  if !raw_errors.is_empty() {
+    raw.insert("errors".to_string(), Value::Array(raw_errors));
+  }
+
+  CompileOutput {
+    raw_artifacts: Value::Object(raw),
+    artifacts,
+    artifact,
+    errors,
+  }
+}
+
 fn to_core_secondary_location(
   location: &FoundrySecondarySourceLocation,
 ) -> SecondarySourceLocation {
@@ -531,8 +594,9 @@ fn clamp_u64_to_i32(value: u64) -> i32 {
 
 fn collate_project_artifacts(
   output: &ProjectCompileOutput<MultiCompiler>,
-) -> BTreeMap<String, SourceArtifacts> {
-  let mut artifacts: BTreeMap<String, SourceArtifacts> = BTreeMap::new();
+) -> BTreeMap<Arc<str>, SourceArtifacts> {
+  let mut interner = StringInterner::new();
+  let mut artifacts: BTreeMap<Arc<str>, SourceArtifacts> = BTreeMap::new();
 
   let mut version_lookup: BTreeMap<(String, String), Version> = BTreeMap::new();
   for (path, name, _, version) in output.output().contracts.contracts_with_files_and_version() {
@@ -541,29 +605,32 @@ fn collate_project_artifacts(
   }
 
   for (path, name, artifact) in output.artifacts_with_files() {
-    let key = path.to_string_lossy().to_string();
+    let key = interner.intern(&path.to_string_lossy());
     let entry = artifacts
-      .entry(key.clone())
-      .or_insert_with(|| SourceArtifacts::new(Some(key.clone())));
+      .entry(Arc::clone(&key))
+      .or_insert_with(|| SourceArtifacts::new(Some(Arc::clone(&key))));
 
-    let version = version_lookup.get(&(key.clone(), name.clone())).cloned();
+    let version = version_lookup
+      .get(&(key.to_string(), name.clone()))
+      .cloned();
     if entry.solc_version.is_none() {
       entry.solc_version = version.clone();
     }
 
-    let mut contract = Contract::from_configurable_artifact(name.clone(), artifact);
-    contract.state_mut().source_path = Some(key.clone());
+    let name = interner.intern(name);
+    let mut contract = Contract::from_configurable_artifact(Arc::clone(&name), artifact);
+    contract.state_mut().source_path = Some(Arc::clone(&key));
     if entry.source_id.is_none() {
       entry.source_id = contract.state().source_id;
     }
-    entry.contracts.insert(name.clone(), contract);
+    entry.contracts.insert(name, contract);
   }
 
   for (path, source, version) in output.output().sources.sources_with_version() {
-    let key = path.to_string_lossy().to_string();
+    let key = interner.intern(&path.to_string_lossy());
     let entry = artifacts
-      .entry(key.clone())
-      .or_insert_with(|| SourceArtifacts::new(Some(key.clone())));
+      .entry(Arc::clone(&key))
+      .or_insert_with(|| SourceArtifacts::new(Some(key)));
     if entry.solc_version.is_none() {
       entry.solc_version = Some(version.clone());
     }
@@ -623,43 +690,27 @@ where
 
 /// Wrapper sent over N-API describing the artifacts emitted for a single source file. Provides
 /// ergonomic getters (and lazily constructs `Ast` helpers) without forcing consumers to inspect raw
-/// JSON blobs.
+/// JSON blobs. The underlying [`SourceArtifacts`] stays in Rust behind an `Arc`; contracts, ASTs,
+/// and the JSON snapshot are only converted into JS values when the corresponding getter runs, so
+/// untouched entries cost nothing on the N-API boundary.
 #[napi(js_name = "SourceArtifacts")]
 #[derive(Clone, Debug)]
 pub struct JsSourceArtifacts {
-  /// Canonicalised source path for this artifact bundle.
-  source_path: Option<String>,
-  /// Numeric source identifier assigned by solc (mirrors `sources[<path>].id`).
-  source_id: Option<u32>,
-  /// Solc version recorded for this source.
-  solc_version: Option<Version>,
-  /// Sanitised AST captured for the source when emitted by the compiler.
-  ast_unit: Option<Value>,
-  /// JSON snapshot retained for cheap serialization via `to_json()`.
-  json: SourceArtifactsJson,
-  /// Contracts emitted for the source keyed by name (rich `Contract` wrappers, not plain JSON).
-  contracts: HashMap<String, Contract>,
+  /// Shared native artifact bundle this handle reads from.
+  core: Arc<SourceArtifacts>,
+  /// JSON snapshot built on first `to_json()` call and shared across clones of this handle.
+  json: Arc<OnceLock<SourceArtifactsJson>>,
 }
 
 impl JsSourceArtifacts {
   fn from_core(artifacts: SourceArtifacts) -> Self {
-    let json = artifacts.to_json();
-
-    let SourceArtifacts {
-      source_path,
-      source_id,
-      solc_version,
-      ast,
-      contracts,
-    } = artifacts;
+    Self::from_shared(Arc::new(artifacts))
+  }
 
+  fn from_shared(core: Arc<SourceArtifacts>) -> Self {
     Self {
-      source_path,
-      source_id,
-      solc_version,
-      ast_unit: ast,
-      json,
-      contracts: contracts.into_iter().collect(),
+      core,
+      json: Arc::new(OnceLock::new()),
     }
   }
 
@@ -667,7 +718,7 @@ impl JsSourceArtifacts {
     let mut options = AstConfigOptions::default();
     let mut has_override = false;
 
-    if let Some(version) = &self.solc_version {
+    if let Some(version) = &self.core.solc_version {
       options.solc.version = Some(version.clone());
       has_override = true;
     }
@@ -678,6 +729,10 @@ impl JsSourceArtifacts {
       None
     }
   }
+
+  fn force_json(&self) -> &SourceArtifactsJson {
+    self.json.get_or_init(|| self.core.to_json())
+  }
 }
 
 #[napi]
@@ -685,32 +740,26 @@ impl JsSourceArtifacts {
   /// Construct an empty artifact bundle. Mainly used in tests when stubbing return values.
   #[napi(constructor)]
   pub fn new() -> Self {
-    Self {
-      source_path: None,
-      source_id: None,
-      solc_version: None,
-      ast_unit: None,
-      json: SourceArtifactsJson::default(),
-      contracts: HashMap::new(),
-    }
+    Self::from_core(SourceArtifacts::default())
   }
 
   /// Absolute or synthetic path to the source that produced these artifacts.
   #[napi(getter)]
   pub fn source_path(&self) -> Option<String> {
-    self.source_path.clone()
+    self.core.source_path.as_deref().map(str::to_string)
   }
 
   /// Solc source identifier when available.
   #[napi(getter)]
   pub fn source_id(&self) -> Option<u32> {
-    self.source_id
+    self.core.source_id
   }
 
   /// Solc version string that emitted these artifacts, if recorded.
   #[napi(getter)]
   pub fn solc_version(&self) -> Option<String> {
     self
+      .core
       .solc_version
       .as_ref()
       .map(|version| version.to_string())
@@ -719,7 +768,7 @@ impl JsSourceArtifacts {
   /// Lazily materialise the Solidity AST as a reusable `Ast` helper instance.
   #[napi(getter, ts_return_type = "Ast | undefined")]
   pub fn ast(&self) -> napi::Result<Option<JsAst>> {
-    let unit = match &self.ast_unit {
+    let unit = match &self.core.ast {
       Some(unit) => unit.clone(),
       None => return Ok(None),
     };
@@ -733,39 +782,43 @@ impl JsSourceArtifacts {
     Ok(Some(JsAst::from_ast(ast)))
   }
 
-  /// Contracts produced for this source keyed by contract name.
+  /// Contracts produced for this source keyed by contract name. Each `Contract` wrapper is built
+  /// on access; callers that never read a source's contracts never pay for their conversion.
   #[napi(getter, ts_return_type = "Record<string, Contract>")]
   pub fn contracts(&self) -> HashMap<String, JsContract> {
     self
+      .core
       .contracts
       .iter()
-      .map(|(name, contract)| (name.clone(), contract::contract_class(contract)))
+      .map(|(name, contract)| (name.to_string(), contract::contract_class(contract)))
       .collect()
   }
 
-  /// Snapshot this artifact bundle as a serialisable JSON structure.
+  /// Snapshot this artifact bundle as a serialisable JSON structure. The snapshot is computed on
+  /// the first call and cached afterwards; the cached copy is written straight into JS values
+  /// rather than being cloned per call.
   #[napi(js_name = "toJson", ts_return_type = "SourceArtifactsJson")]
-  pub fn to_json(&self) -> SourceArtifactsJson {
-    self.json.clone()
+  pub fn to_json(&self, env: Env) -> napi::Result<JsUnknown> {
+    napi_ser::to_js(&env, self.force_json())
   }
 }
 
 /// JavaScript-facing mirror of `CompileOutput` with ergonomic getters for downstream tooling. This
 /// is what the TypeScript layer surfaces as `CompileOutput<THasErrors, TPaths>`.
+///
+/// The handle is lazy: the native [`CompileOutput`] is kept behind an `Arc` and nothing is
+/// converted into JS objects until a getter asks for it. Per-source wrappers are built once and
+/// shared between `artifacts`, `artifact`, and [`JsCompileOutput::materialize`], so repeated reads
+/// reuse the same cached conversions.
 #[napi(js_name = "CompileOutput")]
 #[derive(Clone, Debug)]
 pub struct JsCompileOutput {
-  /// Eagerly prepared JSON snapshot for this compile output.
-  json: CompileOutputJson,
-  /// Raw artifact tree mirroring the underlying compiler response (equivalent to
-  /// `compileOutput.rawArtifacts`).
-  raw_artifacts: Value,
-  /// Map of source paths to their compiled artifacts.
-  artifacts: HashMap<String, JsSourceArtifacts>,
-  /// Convenience handle when only a single source produced artifacts.
-  artifact: Option<JsSourceArtifacts>,
-  /// Diagnostics produced during compilation.
-  errors: Vec<CompilerError>,
+  /// Shared native compile output this handle reads from.
+  core: Arc<CompileOutput>,
+  /// Per-source lazy wrappers, constructed on first access to `artifacts` or `artifact`.
+  wrappers: Arc<OnceLock<HashMap<String, JsSourceArtifacts>>>,
+  /// Full JSON snapshot, computed on first `to_json()`/`materialize()` call.
+  json: Arc<OnceLock<CompileOutputJson>>,
   /// Cached flag indicating whether any diagnostic has error severity.
   has_compiler_errors: bool,
 }
@@ -773,29 +826,29 @@ pub struct JsCompileOutput {
 impl JsCompileOutput {
   fn from_core(core: CompileOutput) -> Self {
     let has_compiler_errors = core.has_compiler_errors();
-    let json = core.to_json();
-    let CompileOutput {
-      raw_artifacts,
-      artifacts,
-      artifact,
-      errors,
-    } = core;
-
-    let artifacts = artifacts
-      .into_iter()
-      .map(|(path, artifacts)| (path, JsSourceArtifacts::from_core(artifacts)))
-      .collect::<HashMap<_, _>>();
-    let artifact = artifact.map(JsSourceArtifacts::from_core);
-
     Self {
-      json,
-      raw_artifacts,
-      artifacts,
-      artifact,
-      errors,
+      core: Arc::new(core),
+      wrappers: Arc::new(OnceLock::new()),
+      json: Arc::new(OnceLock::new()),
       has_compiler_errors,
     }
   }
+
+  fn source_wrappers(&self) -> &HashMap<String, JsSourceArtifacts> {
+    self.wrappers.get_or_init(|| {
+      self
+        .core
+        .artifacts
+        .iter()
+        .map(|(path, artifacts)| {
+          (
+            path.to_string(),
+            JsSourceArtifacts::from_shared(Arc::new(artifacts.clone())),
+          )
+        })
+        .collect()
+    })
+  }
 }
 
 #[napi]
@@ -803,55 +856,50 @@ impl JsCompileOutput {
   /// Create an empty compile output handle. Primarily reserved for tests.
   #[napi(constructor)]
   pub fn new() -> Self {
-    Self {
-      json: CompileOutputJson::default(),
-      raw_artifacts: Value::Null,
-      artifacts: HashMap::new(),
-      artifact: None,
-      errors: Vec::new(),
-      has_compiler_errors: false,
-    }
+    Self::from_core(CompileOutput::default())
   }
 
-  /// Raw standard JSON artifact object returned by the underlying compiler.
+  /// Raw standard JSON artifact object returned by the underlying compiler. Written into JS
+  /// values directly from the shared native tree, so reading it never clones the raw artifacts.
   #[napi(
     getter,
     js_name = "artifactsJson",
     ts_return_type = "Record<string, unknown>"
   )]
-  pub fn raw_artifacts(&self) -> Value {
-    self.raw_artifacts.clone()
+  pub fn raw_artifacts(&self, env: Env) -> napi::Result<JsUnknown> {
+    napi_ser::to_js(&env, &self.core.raw_artifacts)
   }
 
-  /// Mapping of source paths to compiled artifacts.
+  /// Mapping of source paths to compiled artifacts. Entries are lazy handles; reading the map does
+  /// not convert contracts or ASTs until the individual entry is inspected.
   #[napi(getter, ts_return_type = "Record<string, SourceArtifacts>")]
   pub fn artifacts(&self) -> HashMap<String, JsSourceArtifacts> {
-    self.artifacts.clone()
+    self.source_wrappers().clone()
   }
 
   /// Convenience accessor when only a single source produced output.
   #[napi(getter, ts_return_type = "SourceArtifacts | undefined")]
   pub fn artifact(&self) -> Option<JsSourceArtifacts> {
-    self.artifact.clone()
+    if self.core.artifact.is_none() {
+      return None;
+    }
+    self.source_wrappers().values().next().cloned()
   }
 
   /// Compiler diagnostics promoted to `Error` severity.
   #[napi(getter, ts_return_type = "ReadonlyArray<CompilerError> | undefined")]
   pub fn errors(&self, env: Env) -> napi::Result<JsUnknown> {
     if self.has_compiler_errors() {
-      let value = env
-        .to_js_value(&self.errors)
-        .map_err(|err| napi_error(err.to_string()))?;
-      Ok(value)
+      napi_ser::to_js(&env, &self.core.errors)
     } else {
       Ok(env.get_undefined()?.into_unknown())
     }
   }
 
   /// Full diagnostic list regardless of severity. Useful for editor integrations.
-  #[napi(getter)]
-  pub fn diagnostics(&self) -> Vec<CompilerError> {
-    self.errors.clone()
+  #[napi(getter, ts_return_type = "Array<CompilerError>")]
+  pub fn diagnostics(&self, env: Env) -> napi::Result<JsUnknown> {
+    napi_ser::to_js(&env, &self.core.errors)
   }
 
   /// Return whether the compile output contains any errors.
@@ -860,17 +908,46 @@ impl JsCompileOutput {
     self.has_compiler_errors
   }
 
-  /// Serialise the compile output as JSON for transport or persistence.
+  /// Eagerly convert the full output graph and return the resulting snapshot. Escape hatch for
+  /// callers that want every artifact as plain JS data up front instead of paying the conversion
+  /// cost per property access.
+  #[napi(ts_return_type = "CompileOutputJson")]
+  pub fn materialize(&self, env: Env) -> napi::Result<JsUnknown> {
+    for wrapper in self.source_wrappers().values() {
+      wrapper.force_json();
+    }
+    self.to_json(env)
+  }
+
+  /// Serialise the compile output as JSON for transport or persistence. The snapshot is computed
+  /// on the first call and cached afterwards; the cached copy is written straight into JS values
+  /// rather than being cloned per call.
   #[napi(js_name = "toJson", ts_return_type = "CompileOutputJson")]
-  pub fn to_json(&self) -> CompileOutputJson {
-    self.json.clone()
+  pub fn to_json(&self, env: Env) -> napi::Result<JsUnknown> {
+    napi_ser::to_js(&env, self.json.get_or_init(|| self.core.to_json()))
   }
 }
 
 pub fn into_js_compile_output(core: CompileOutput) -> JsCompileOutput {
+  let _span = metrics::span(metrics::Phase::OutputConversion);
   JsCompileOutput::from_core(core)
 }
 
+/// Single contract handed to JS while `compileProjectStream` drains a project compile. Entries
+/// carry the serialisable contract snapshot so consumers can start deploying or indexing a
+/// contract before the rest of the build has been converted.
+#[napi(object, js_name = "ProjectStreamEntry")]
+#[derive(Clone, Debug)]
+pub struct JsProjectStreamEntry {
+  /// Canonical source path that produced the contract.
+  pub path: String,
+  /// Contract name within the source file.
+  pub contract_name: String,
+  /// Serialisable contract snapshot (ABI, bytecode, metadata, …).
+  #[napi(ts_type = "ContractState")]
+  pub contract: JsContractState,
+}
+
 // -----------------------------------------------------------------------------
 // Tests
 // -----------------------------------------------------------------------------
@@ -1058,11 +1135,11 @@ mod tests {
 
     let js_output = into_js_compile_output(core);
     assert!(js_output
-      .artifacts
+      .source_wrappers()
       .get("Widget.sol")
-      .and_then(|entry| entry.contracts.get("Widget"))
+      .and_then(|entry| entry.core.contracts.get("Widget"))
       .is_some());
-    let snapshot = js_output.to_json();
+    let snapshot = js_output.core.to_json();
     assert!(snapshot
       .artifacts
       .as_ref()
@@ -1072,14 +1149,50 @@ mod tests {
       .is_some());
     assert!(snapshot.raw_artifacts.is_some());
     assert!(js_output.has_compiler_errors());
-    assert_eq!(js_output.errors.len(), 1);
-    assert_eq!(js_output.errors[0].severity, SeverityLevel::Error);
+    assert_eq!(js_output.core.errors.len(), 1);
+    assert_eq!(js_output.core.errors[0].severity, SeverityLevel::Error);
     assert_eq!(
-      js_output.errors[0]
+      js_output.core.errors[0]
         .source_location
         .as_ref()
         .map(|loc| loc.file.as_str()),
       Some("Test.sol")
     );
   }
+
+  #[test]
+  fn js_compile_output_converts_lazily_and_caches() {
+    let mut core = CompileOutput {
+      raw_artifacts: json!({ "contracts": {} }),
+      ..Default::default()
+    };
+    let mut artifacts = SourceArtifacts::default();
+    artifacts
+      .contracts
+      .insert("Widget".into(), Contract::new("Widget"));
+    core
+      .artifacts
+      .insert("Widget.sol".into(), artifacts.clone());
+    core.artifact = Some(artifacts);
+
+    let js_output = into_js_compile_output(core);
+    assert!(js_output.wrappers.get().is_none());
+    assert!(js_output.json.get().is_none());
+
+    let entry = js_output.artifact().expect("single artifact handle");
+    assert!(js_output.wrappers.get().is_some());
+    assert!(entry.json.get().is_none());
+
+    let snapshot = entry.force_json();
+    assert!(entry.json.get().is_some());
+    assert!(snapshot
+      .contracts
+      .as_ref()
+      .and_then(|contracts| contracts.get("Widget"))
+      .is_some());
+
+    let full = js_output.json.get_or_init(|| js_output.core.to_json());
+    assert!(js_output.json.get().is_some());
+    assert!(full.artifact.is_some());
+  }
 }
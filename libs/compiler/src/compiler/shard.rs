@@ -0,0 +1,281 @@
+use std::collections::BTreeMap;
+use std::path::PathBuf;
+
+use foundry_compilers::artifacts::Sources;
+
+/// Partition a set of in-memory sources into independent compilation shards by connecting files
+/// through their `import` statements. Files that only import each other land in the same shard and
+/// can be handed to separate solc processes without changing the output.
+///
+/// The partitioning is deliberately conservative: when any file imports something that cannot be
+/// resolved inside the provided set (a remapped dependency, a disk path reachable via
+/// `--allow-paths`, …) everything is kept in a single shard so solc still sees the full context.
+pub(crate) fn partition_sources(sources: &Sources) -> Vec<Sources> {
+  if sources.len() < 2 {
+    return vec![sources.clone()];
+  }
+
+  let keys: Vec<&PathBuf> = sources.keys().collect();
+  let mut parent: Vec<usize> = (0..keys.len()).collect();
+
+  fn find(parent: &mut Vec<usize>, node: usize) -> usize {
+    let mut root = node;
+    while parent[root] != root {
+      root = parent[root];
+    }
+    let mut current = node;
+    while parent[current] != root {
+      let next = parent[current];
+      parent[current] = root;
+      current = next;
+    }
+    root
+  }
+
+  fn union(parent: &mut Vec<usize>, left: usize, right: usize) {
+    let left_root = find(parent, left);
+    let right_root = find(parent, right);
+    if left_root != right_root {
+      parent[right_root] = left_root;
+    }
+  }
+
+  for (index, key) in keys.iter().enumerate() {
+    let source = &sources[*key];
+    for import in import_paths(source.content.as_str()) {
+      match resolve_import(&keys, key, &import) {
+        Some(target) => union(&mut parent, index, target),
+        None => return vec![sources.clone()],
+      }
+    }
+  }
+
+  let mut shards: BTreeMap<usize, Sources> = BTreeMap::new();
+  for (index, key) in keys.iter().enumerate() {
+    let root = find(&mut parent, index);
+    shards
+      .entry(root)
+      .or_default()
+      .insert((*key).clone(), sources[*key].clone());
+  }
+
+  shards.into_values().collect()
+}
+
+/// Extract the quoted path of every `import` directive in a Solidity source. Handles the plain,
+/// aliased, and selective forms (`import "a.sol";`, `import "a.sol" as A;`, `import {X} from
+/// "a.sol";`) and skips over comments so commented-out imports do not create false edges.
+pub(crate) fn import_paths(source: &str) -> Vec<String> {
+  let mut imports = Vec::new();
+  let stripped = strip_comments(source);
+  let bytes = stripped.as_bytes();
+  let mut cursor = 0;
+
+  while let Some(offset) = stripped[cursor..].find("import") {
+    let start = cursor + offset;
+    cursor = start + "import".len();
+    let preceded_ok =
+      start == 0 || !bytes[start - 1].is_ascii_alphanumeric() && bytes[start - 1] != b'_';
+    let followed_ok =
+      cursor >= bytes.len() || !bytes[cursor].is_ascii_alphanumeric() && bytes[cursor] != b'_';
+    if !preceded_ok || !followed_ok {
+      continue;
+    }
+    let Some(terminator) = stripped[cursor..].find(';') else {
+      break;
+    };
+    let statement = &stripped[cursor..cursor + terminator];
+    if let Some(path) = last_quoted(statement) {
+      imports.push(path);
+    }
+    cursor += terminator + 1;
+  }
+
+  imports
+}
+
+fn last_quoted(statement: &str) -> Option<String> {
+  let mut result = None;
+  let mut rest = statement;
+  loop {
+    let open_rel = match (rest.find('"'), rest.find('\'')) {
+      (Some(a), Some(b)) => a.min(b),
+      (Some(a), None) => a,
+      (None, Some(b)) => b,
+      (None, None) => break,
+    };
+    let quote = rest.as_bytes()[open_rel];
+    let after = &rest[open_rel + 1..];
+    let Some(close_rel) = after.find(quote as char) else {
+      break;
+    };
+    result = Some(after[..close_rel].to_string());
+    rest = &after[close_rel + 1..];
+  }
+  result
+}
+
+fn strip_comments(source: &str) -> String {
+  let mut result = String::with_capacity(source.len());
+  let bytes = source.as_bytes();
+  let mut index = 0;
+  while index < bytes.len() {
+    if bytes[index] == b'/' && index + 1 < bytes.len() {
+      match bytes[index + 1] {
+        b'/' => {
+          while index < bytes.len() && bytes[index] != b'\n' {
+            index += 1;
+          }
+          continue;
+        }
+        b'*' => {
+          index += 2;
+          while index + 1 < bytes.len() && !(bytes[index] == b'*' && bytes[index + 1] == b'/') {
+            index += 1;
+          }
+          index = (index + 2).min(bytes.len());
+          result.push(' ');
+          continue;
+        }
+        _ => {}
+      }
+    }
+    result.push(bytes[index] as char);
+    index += 1;
+  }
+  result
+}
+
+/// Match an import path against the virtual file names in the source set. Relative segments are
+/// dropped and the remainder must line up with the tail of exactly one key.
+fn resolve_import(keys: &[&PathBuf], importer: &PathBuf, import: &str) -> Option<usize> {
+  let normalised = normalise_relative(importer, import)?;
+  let mut resolved = None;
+  for (index, key) in keys.iter().enumerate() {
+    if paths_match(key, &normalised) {
+      if resolved.is_some() {
+        return None;
+      }
+      resolved = Some(index);
+    }
+  }
+  resolved
+}
+
+fn normalise_relative(importer: &PathBuf, import: &str) -> Option<PathBuf> {
+  if !import.starts_with('.') {
+    return Some(PathBuf::from(import));
+  }
+  let mut base: Vec<String> = importer
+    .parent()
+    .map(|parent| {
+      parent
+        .components()
+        .map(|component| component.as_os_str().to_string_lossy().into_owned())
+        .collect()
+    })
+    .unwrap_or_default();
+  for segment in import.split('/') {
+    match segment {
+      "." | "" => {}
+      ".." => {
+        base.pop()?;
+      }
+      other => base.push(other.to_string()),
+    }
+  }
+  Some(base.iter().collect())
+}
+
+fn paths_match(key: &PathBuf, import: &PathBuf) -> bool {
+  if key == import {
+    return true;
+  }
+  key.ends_with(import)
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+  use foundry_compilers::artifacts::Source;
+
+  fn sources(entries: &[(&str, &str)]) -> Sources {
+    entries
+      .iter()
+      .map(|(path, content)| (PathBuf::from(path), Source::new(*content)))
+      .collect()
+  }
+
+  #[test]
+  fn independent_files_land_in_separate_shards() {
+    let sources = sources(&[
+      ("A.sol", "contract A {}"),
+      ("B.sol", "contract B {}"),
+      ("C.sol", "contract C {}"),
+    ]);
+    let shards = partition_sources(&sources);
+    assert_eq!(shards.len(), 3);
+  }
+
+  #[test]
+  fn imports_join_files_into_one_shard() {
+    let sources = sources(&[
+      ("A.sol", "import \"./B.sol\";\ncontract A {}"),
+      ("B.sol", "contract B {}"),
+      ("C.sol", "contract C {}"),
+    ]);
+    let shards = partition_sources(&sources);
+    assert_eq!(shards.len(), 2);
+    let joined = shards
+      .iter()
+      .find(|shard| shard.contains_key(&PathBuf::from("A.sol")))
+      .expect("shard with A");
+    assert!(joined.contains_key(&PathBuf::from("B.sol")));
+  }
+
+  #[test]
+  fn unresolved_imports_disable_sharding() {
+    let sources = sources(&[
+      ("A.sol", "import \"@openzeppelin/token/ERC20.sol\";"),
+      ("B.sol", "contract B {}"),
+    ]);
+    let shards = partition_sources(&sources);
+    assert_eq!(shards.len(), 1);
+  }
+
+  #[test]
+  fn commented_imports_are_ignored() {
+    let sources = sources(&[
+      (
+        "A.sol",
+        "// import \"./B.sol\";\n/* import \"./B.sol\"; */\ncontract A {}",
+      ),
+      ("B.sol", "contract B {}"),
+    ]);
+    let shards = partition_sources(&sources);
+    assert_eq!(shards.len(), 2);
+  }
+
+  #[test]
+  fn selective_imports_are_detected() {
+    assert_eq!(
+      import_paths("import {Token} from \"./tokens/Token.sol\";"),
+      vec!["./tokens/Token.sol".to_string()]
+    );
+    assert_eq!(
+      import_paths("import 'lib/Util.sol' as Util;"),
+      vec!["lib/Util.sol".to_string()]
+    );
+  }
+
+  #[test]
+  fn relative_segments_resolve_against_the_importer() {
+    let sources = sources(&[
+      ("contracts/A.sol", "import \"../lib/B.sol\";"),
+      ("lib/B.sol", "contract B {}"),
+      ("C.sol", "contract C {}"),
+    ]);
+    let shards = partition_sources(&sources);
+    assert_eq!(shards.len(), 2);
+  }
+}
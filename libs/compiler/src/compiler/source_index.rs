@@ -0,0 +1,393 @@
+use std::collections::BTreeSet;
+use std::fs;
+use std::path::{Path, PathBuf};
+
+use log::{debug, info, warn};
+use serde_json::Value;
+
+use super::core::{compile_files, State};
+use super::output::{merge_compile_outputs, CompileOutput};
+use super::watcher::{PersistedRecord, WatchGraph};
+use crate::internal::config::CompilerConfig;
+use crate::internal::errors::Result;
+use crate::internal::project::{ProjectContext, ProjectLayout};
+
+const LOG_TARGET: &str = "tevm::compiler.cache.sources";
+
+/// Magic prefix identifying the index format. The trailing digits are the format version: bump
+/// them whenever the serialized layout of the index or of [`CompileOutput`] changes so indexes
+/// written by older builds read as misses instead of corrupt data.
+const MAGIC: &[u8; 8] = b"TEVMSX02";
+
+const INDEX_FILE: &str = "source-index.bin";
+
+/// Content-addressed source index persisted between processes. Unlike Foundry's
+/// `solidity-files-cache.json`, which keys freshness on mtimes that CI checkouts routinely reset,
+/// the index records a blake3 digest and the import edges of every source, plus the full compile
+/// output those digests produced. A warm `compileProject` re-hashes the tree, recompiles only the
+/// dirty transitive closure, and splices the fresh artifacts over the baseline.
+#[derive(serde::Serialize, serde::Deserialize)]
+struct PersistedIndex {
+  config_digest: [u8; 32],
+  files: Vec<PersistedRecord>,
+  baseline: CompileOutput,
+}
+
+/// Attempt to serve a project compile incrementally from the persisted index. Returns `None`
+/// whenever the index cannot be used — caching disabled, no index yet, configuration changed, or
+/// a dirty file the incremental path cannot handle — in which case the caller runs a full build.
+pub(crate) fn try_incremental(
+  state: &State,
+  config: &CompilerConfig,
+) -> Option<Result<CompileOutput>> {
+  if !config.cache_enabled {
+    return None;
+  }
+  let context = state.project.as_ref()?;
+  if matches!(context.layout, ProjectLayout::Synthetic) || !config.language.is_solc_language() {
+    return None;
+  }
+
+  let digest = config_digest(config);
+  let index = load(&context.root, &digest)?;
+  let previous_paths: Vec<PathBuf> = index
+    .files
+    .iter()
+    .map(|record| record.path.clone())
+    .collect();
+  let mut graph = WatchGraph::from_records(context, config, &extra_roots(context), index.files);
+  let dirty = match graph.scan() {
+    Ok(dirty) => dirty,
+    Err(err) => {
+      warn!(
+        target: LOG_TARGET,
+        "source index scan failed; falling back to a full build: {err}"
+      );
+      return None;
+    }
+  };
+
+  if dirty.is_empty() {
+    info!(
+      target: LOG_TARGET,
+      "project sources unchanged; serving compile from source index"
+    );
+    return Some(Ok(index.baseline));
+  }
+
+  if dirty
+    .iter()
+    .any(|path| path.extension().and_then(|ext| ext.to_str()) == Some("vy"))
+  {
+    debug!(
+      target: LOG_TARGET,
+      "dirty set contains Vyper sources; falling back to a full build"
+    );
+    return None;
+  }
+
+  // Solc's standard-JSON input has no import callback, so the reverse dirty closure must be
+  // widened forward over imports until it is self-contained.
+  let closure = graph.import_closure(&dirty);
+  let records = graph.records();
+  info!(
+    target: LOG_TARGET,
+    "recompiling dirty closure ({} dirty, {} with imports, {} tracked)",
+    dirty.len(),
+    closure.len(),
+    records.len()
+  );
+
+  let fresh = match compile_files(config, closure.clone(), None) {
+    Ok(fresh) => fresh,
+    Err(err) => {
+      warn!(
+        target: LOG_TARGET,
+        "incremental recompile failed; falling back to a full build: {err}"
+      );
+      return None;
+    }
+  };
+
+  let mut stale = key_forms(&context.root, &closure);
+  // Removed files no longer appear in the graph but their old artifacts must still be dropped.
+  for path in &previous_paths {
+    if !records.iter().any(|tracked| &tracked.path == path) {
+      stale.extend(key_forms(&context.root, std::slice::from_ref(path)));
+    }
+  }
+
+  let baseline = prune_output(index.baseline, &stale);
+  let merged = merge_compile_outputs(vec![baseline, fresh]);
+  persist(&context.root, &digest, records, &merged);
+  Some(Ok(merged))
+}
+
+/// Record a completed full project build so the next process can compile incrementally. Outputs
+/// with compiler errors are not recorded: splicing fresh artifacts over a broken baseline would
+/// resurface stale diagnostics.
+pub(crate) fn record_full_build(state: &State, config: &CompilerConfig, output: &CompileOutput) {
+  if !config.cache_enabled || output.has_compiler_errors() {
+    return;
+  }
+  let Some(context) = state.project.as_ref() else {
+    return;
+  };
+  if matches!(context.layout, ProjectLayout::Synthetic) || !config.language.is_solc_language() {
+    return;
+  }
+
+  let mut graph = WatchGraph::from_records(context, config, &extra_roots(context), Vec::new());
+  if let Err(err) = graph.scan() {
+    warn!(
+      target: LOG_TARGET,
+      "failed to index project sources after build: {err}"
+    );
+    return;
+  }
+  persist(
+    &context.root,
+    &config_digest(config),
+    graph.records(),
+    output,
+  );
+}
+
+/// The project compile covers tests and scripts in addition to the watcher's sources + libraries
+/// set, so the index tracks those directories too.
+fn extra_roots(context: &ProjectContext) -> Vec<PathBuf> {
+  vec![context.paths.tests.clone(), context.paths.scripts.clone()]
+}
+
+/// Digest of the configuration inputs that influence compiled artifacts. A mismatch means the
+/// baseline was produced under different settings and has to be rebuilt from scratch.
+fn config_digest(config: &CompilerConfig) -> blake3::Hash {
+  let mut hasher = blake3::Hasher::new();
+  hasher.update(format!("{:?}", config.language).as_bytes());
+  hasher.update(config.solc_version.to_string().as_bytes());
+  if let Ok(settings) = serde_json::to_vec(&config.solc_settings) {
+    hasher.update(&settings);
+  }
+  for remapping in &config.remappings {
+    hasher.update(remapping.to_string().as_bytes());
+  }
+  hasher.finalize()
+}
+
+/// Every string form a compile output may use to key artifacts for `path`: the scanned absolute
+/// path, its canonicalised form, and the project-relative form Foundry reports for some layouts.
+fn key_forms(root: &Path, paths: &[PathBuf]) -> BTreeSet<String> {
+  let mut forms = BTreeSet::new();
+  for path in paths {
+    forms.insert(path.to_string_lossy().into_owned());
+    if let Ok(canonical) = path.canonicalize() {
+      forms.insert(canonical.to_string_lossy().into_owned());
+    }
+    if let Ok(relative) = path.strip_prefix(root) {
+      forms.insert(relative.to_string_lossy().into_owned());
+    }
+  }
+  forms
+}
+
+/// Drop every artifact, raw entry, and diagnostic keyed by a stale source from the baseline,
+/// leaving only output that the incremental recompile did not touch.
+fn prune_output(mut output: CompileOutput, stale: &BTreeSet<String>) -> CompileOutput {
+  output
+    .artifacts
+    .retain(|key, _| !stale.contains(key.as_ref()));
+  output
+    .errors
+    .retain(|error| match error.source_location.as_ref() {
+      Some(location) => !stale.contains(&location.file),
+      None => true,
+    });
+
+  if let Value::Object(raw) = &mut output.raw_artifacts {
+    for section in ["contracts", "sources"] {
+      if let Some(Value::Object(entries)) = raw.get_mut(section) {
+        entries.retain(|key, _| !stale.contains(key));
+      }
+    }
+    if let Some(Value::Array(errors)) = raw.get_mut("errors") {
+      errors.retain(|error| {
+        error
+          .pointer("/sourceLocation/file")
+          .and_then(Value::as_str)
+          .map(|file| !stale.contains(file))
+          .unwrap_or(true)
+      });
+    }
+  }
+
+  output.artifact = output
+    .artifacts
+    .values()
+    .next()
+    .cloned()
+    .filter(|_| output.artifacts.len() == 1);
+  output
+}
+
+fn index_path(root: &Path) -> PathBuf {
+  root.join(".tevm").join(INDEX_FILE)
+}
+
+/// Loads the index for `root` when it matches `digest`. Unreadable, version-mismatched, or stale
+/// indexes are removed and treated as misses — the index is an optimisation, never an error
+/// source.
+fn load(root: &Path, digest: &blake3::Hash) -> Option<PersistedIndex> {
+  let path = index_path(root);
+  let bytes = fs::read(&path).ok()?;
+  match decode(&bytes, digest) {
+    Some(index) => Some(index),
+    None => {
+      debug!(
+        target: LOG_TARGET,
+        "discarding stale source index {}",
+        path.display()
+      );
+      let _ = fs::remove_file(&path);
+      None
+    }
+  }
+}
+
+fn decode(bytes: &[u8], digest: &blake3::Hash) -> Option<PersistedIndex> {
+  let payload = bytes.strip_prefix(MAGIC)?;
+  let index: PersistedIndex = rmp_serde::from_slice(payload).ok()?;
+  (index.config_digest == *digest.as_bytes()).then_some(index)
+}
+
+/// Persists the index under `root`. Failures are logged and swallowed; the caller already has the
+/// compiled output in hand.
+fn persist(
+  root: &Path,
+  digest: &blake3::Hash,
+  files: Vec<PersistedRecord>,
+  output: &CompileOutput,
+) {
+  if let Err(err) = try_persist(root, digest, files, output) {
+    warn!(
+      target: LOG_TARGET,
+      "failed to persist source index for {}: {err}",
+      root.display()
+    );
+  }
+}
+
+fn try_persist(
+  root: &Path,
+  digest: &blake3::Hash,
+  files: Vec<PersistedRecord>,
+  output: &CompileOutput,
+) -> std::io::Result<()> {
+  let dir = root.join(".tevm");
+  fs::create_dir_all(&dir)?;
+
+  let index = PersistedIndex {
+    config_digest: *digest.as_bytes(),
+    files,
+    baseline: output.clone(),
+  };
+  let mut payload = Vec::with_capacity(MAGIC.len() + 1024);
+  payload.extend_from_slice(MAGIC);
+  rmp_serde::encode::write(&mut payload, &index)
+    .map_err(|err| std::io::Error::other(err.to_string()))?;
+
+  // Write-then-rename keeps concurrent readers from ever seeing a half-written index.
+  let staging = dir.join(format!("{INDEX_FILE}.tmp-{}", std::process::id()));
+  fs::write(&staging, &payload)?;
+  fs::rename(&staging, index_path(root))
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+  use crate::compiler::output::SourceArtifacts;
+  use serde_json::json;
+  use std::collections::BTreeMap;
+  use std::sync::Arc;
+
+  fn sample_output(files: &[&str]) -> CompileOutput {
+    let mut artifacts = BTreeMap::new();
+    let mut raw_contracts = serde_json::Map::new();
+    let mut raw_sources = serde_json::Map::new();
+    for file in files {
+      artifacts.insert(Arc::from(*file), SourceArtifacts::default());
+      raw_contracts.insert((*file).to_string(), json!({}));
+      raw_sources.insert((*file).to_string(), json!({ "id": 0 }));
+    }
+    CompileOutput {
+      raw_artifacts: json!({ "contracts": raw_contracts, "sources": raw_sources }),
+      artifacts,
+      artifact: None,
+      errors: Vec::new(),
+    }
+  }
+
+  #[test]
+  fn indexes_round_trip_through_the_binary_format() {
+    let temp = tempfile::tempdir().expect("tempdir");
+    let digest = blake3::hash(b"settings");
+    let records = vec![PersistedRecord {
+      path: PathBuf::from("/project/src/Counter.sol"),
+      digest: [7u8; 32],
+      imports: vec![PathBuf::from("/project/src/Base.sol")],
+    }];
+    persist(
+      temp.path(),
+      &digest,
+      records,
+      &sample_output(&["/project/src/Counter.sol"]),
+    );
+
+    let index = load(temp.path(), &digest).expect("index should satisfy an unchanged digest");
+    assert_eq!(index.files.len(), 1);
+    assert_eq!(index.files[0].digest, [7u8; 32]);
+    assert!(index
+      .baseline
+      .artifacts
+      .contains_key("/project/src/Counter.sol"));
+
+    let other = blake3::hash(b"different settings");
+    assert!(
+      load(temp.path(), &other).is_none(),
+      "changed configuration should read as a miss"
+    );
+    assert!(
+      !index_path(temp.path()).exists(),
+      "stale index should be discarded"
+    );
+  }
+
+  #[test]
+  fn pruning_drops_only_stale_sources() {
+    let mut output = sample_output(&["/project/src/A.sol", "/project/src/B.sol"]);
+    output.errors.push(crate::compiler::output::CompilerError {
+      message: "stale".into(),
+      formatted_message: None,
+      component: "general".into(),
+      severity: crate::compiler::output::SeverityLevel::Warning,
+      error_type: "Warning".into(),
+      error_code: None,
+      source_location: Some(crate::compiler::output::SourceLocation {
+        file: "/project/src/A.sol".into(),
+        start: 0,
+        end: 1,
+      }),
+      secondary_source_locations: None,
+      vyper_source_location: None,
+    });
+
+    let stale: BTreeSet<String> = ["/project/src/A.sol".to_string()].into_iter().collect();
+    let pruned = prune_output(output, &stale);
+
+    assert!(!pruned.artifacts.contains_key("/project/src/A.sol"));
+    assert!(pruned.artifacts.contains_key("/project/src/B.sol"));
+    assert!(pruned.errors.is_empty());
+    let contracts = pruned.raw_artifacts.pointer("/contracts").unwrap();
+    assert!(contracts.get("/project/src/A.sol").is_none());
+    assert!(contracts.get("/project/src/B.sol").is_some());
+  }
+}
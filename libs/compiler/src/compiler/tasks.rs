@@ -0,0 +1,139 @@
+use std::collections::BTreeMap;
+use std::path::PathBuf;
+
+use napi::bindgen_prelude::AsyncTask;
+use napi::threadsafe_function::{ErrorStrategy, ThreadsafeFunction, ThreadsafeFunctionCallMode};
+use napi::{Env, Task};
+
+use super::core::{
+  compile_contract, compile_files, compile_project, compile_source, compile_sources, SourceTarget,
+  SourceValue, State,
+};
+use super::output::{
+  into_js_compile_output, CompileOutput, CompilerError, JsCompileOutput, JsProjectStreamEntry,
+};
+use crate::contract::contract_state_to_js;
+use crate::internal::config::{CompilerConfig, CompilerLanguage};
+use crate::internal::errors::to_napi_result;
+
+/// Compilation request captured on the JS thread so the heavy lifting can run on a libuv worker.
+/// Options are resolved into a concrete [`CompilerConfig`] before the task is queued, which keeps
+/// `compute` free of any N-API interaction.
+pub(crate) enum CompileRequest {
+  Source {
+    target: SourceTarget,
+  },
+  Sources {
+    sources: BTreeMap<String, SourceValue>,
+  },
+  Files {
+    paths: Vec<PathBuf>,
+    language_override: Option<CompilerLanguage>,
+  },
+  Project,
+  Contract {
+    contract_name: String,
+  },
+}
+
+/// Async counterpart of the synchronous `Compiler.compile*` methods. Each task owns a clone of the
+/// compiler [`State`], so concurrent compiles from multiple JS callers proceed independently on the
+/// worker pool without blocking the event loop.
+pub struct CompileTask {
+  state: State,
+  config: CompilerConfig,
+  request: CompileRequest,
+}
+
+pub(crate) fn compile_async(
+  state: State,
+  config: CompilerConfig,
+  request: CompileRequest,
+) -> AsyncTask<CompileTask> {
+  AsyncTask::new(CompileTask {
+    state,
+    config,
+    request,
+  })
+}
+
+impl Task for CompileTask {
+  type Output = CompileOutput;
+  type JsValue = JsCompileOutput;
+
+  fn compute(&mut self) -> napi::Result<Self::Output> {
+    let result = match &self.request {
+      CompileRequest::Source { target } => {
+        compile_source(&self.state, &self.config, target.clone())
+      }
+      CompileRequest::Sources { sources } => {
+        compile_sources(&self.state, &self.config, sources.clone())
+      }
+      CompileRequest::Files {
+        paths,
+        language_override,
+      } => compile_files(&self.config, paths.clone(), *language_override),
+      CompileRequest::Project => compile_project(&self.state, &self.config),
+      CompileRequest::Contract { contract_name } => {
+        compile_contract(&self.state, &self.config, contract_name)
+      }
+    };
+    to_napi_result(result)
+  }
+
+  fn resolve(&mut self, _env: Env, output: Self::Output) -> napi::Result<Self::JsValue> {
+    Ok(into_js_compile_output(output))
+  }
+}
+
+/// Streaming variant of the project compile. Contracts are detached from the aggregated output on
+/// the worker thread and pushed through the threadsafe-function bridge one at a time, so the JS
+/// side starts receiving entries while later sources are still being converted and the full
+/// per-contract JS tree is never materialised at once. The task's promise resolves with the
+/// compile diagnostics after the last entry has been dispatched.
+pub struct ProjectStreamTask {
+  state: State,
+  config: CompilerConfig,
+  sink: ThreadsafeFunction<JsProjectStreamEntry, ErrorStrategy::Fatal>,
+}
+
+pub(crate) fn compile_project_stream(
+  state: State,
+  config: CompilerConfig,
+  sink: ThreadsafeFunction<JsProjectStreamEntry, ErrorStrategy::Fatal>,
+) -> AsyncTask<ProjectStreamTask> {
+  AsyncTask::new(ProjectStreamTask {
+    state,
+    config,
+    sink,
+  })
+}
+
+impl Task for ProjectStreamTask {
+  type Output = Vec<CompilerError>;
+  type JsValue = Vec<CompilerError>;
+
+  fn compute(&mut self) -> napi::Result<Self::Output> {
+    let output = to_napi_result(compile_project(&self.state, &self.config))?;
+    let CompileOutput {
+      artifacts, errors, ..
+    } = output;
+    for (path, source) in artifacts {
+      for (contract_name, contract) in source.contracts {
+        let entry = JsProjectStreamEntry {
+          path: path.to_string(),
+          contract_name: contract_name.to_string(),
+          contract: contract_state_to_js(contract.state()),
+        };
+        self
+          .sink
+          .call(entry, ThreadsafeFunctionCallMode::NonBlocking);
+      }
+    }
+    Ok(errors)
+  }
+
+  fn resolve(&mut self, _env: Env, errors: Self::Output) -> napi::Result<Self::JsValue> {
+    Ok(errors)
+  }
+}
@@ -0,0 +1,603 @@
+use std::collections::{BTreeSet, HashMap, VecDeque};
+use std::path::{Path, PathBuf};
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::{Arc, Mutex};
+use std::thread::JoinHandle;
+use std::time::{Duration, Instant};
+
+use log::{error, info};
+use napi::threadsafe_function::{ThreadsafeFunction, ThreadsafeFunctionCallMode};
+use napi::JsFunction;
+
+use super::core::compile_files;
+use super::output::{into_js_compile_output, CompileOutput, JsCompileOutput};
+use super::shard;
+use crate::internal::config::CompilerConfig;
+use crate::internal::errors::{napi_error, to_napi_result, Error, Result};
+use crate::internal::project::ProjectContext;
+
+const LOG_TARGET: &str = "tevm::compiler.watcher";
+
+const DEFAULT_POLL_INTERVAL_MS: u32 = 200;
+
+const WATCHED_EXTENSIONS: &[&str] = &["sol", "vy", "yul"];
+
+/// Tracked state for one watched source file: a digest of its last seen contents plus the import
+/// edges extracted from it, which feed the reverse dependency walk.
+struct FileRecord {
+  digest: blake3::Hash,
+  imports: Vec<PathBuf>,
+}
+
+/// Serialisable form of a [`FileRecord`], used by the persisted source index to carry the graph
+/// across processes.
+#[derive(Clone, Debug, serde::Serialize, serde::Deserialize)]
+pub(crate) struct PersistedRecord {
+  pub path: PathBuf,
+  pub digest: [u8; 32],
+  pub imports: Vec<PathBuf>,
+}
+
+/// In-memory import graph over the project's source and library directories. Each scan re-hashes
+/// the watched files (blake3 keeps this in the low milliseconds for ordinary projects, and content
+/// digests are immune to the mtime granularity issues a timestamp comparison would hit), diffs the
+/// digests against the previous scan, and expands the changed set through transitive importers so
+/// a recompile covers exactly the files whose output can differ.
+pub(crate) struct WatchGraph {
+  roots: Vec<PathBuf>,
+  resolve_bases: Vec<PathBuf>,
+  remappings: Vec<(String, PathBuf)>,
+  files: HashMap<PathBuf, FileRecord>,
+}
+
+impl WatchGraph {
+  /// Build the graph from a project context, priming it with the current on-disk state so the
+  /// first call to [`WatchGraph::scan`] only reports files that changed after construction.
+  pub(crate) fn from_project(context: &ProjectContext, config: &CompilerConfig) -> Result<Self> {
+    let mut graph = Self::skeleton(context, config, &[]);
+    graph.scan()?;
+    Ok(graph)
+  }
+
+  /// Build the graph from records persisted by a previous process instead of priming it from
+  /// disk, so the first [`WatchGraph::scan`] reports everything that changed since that process
+  /// ran — regardless of mtimes. `extra_roots` widens the watched directories beyond the default
+  /// sources + libraries set (the project compile also covers tests and scripts).
+  pub(crate) fn from_records(
+    context: &ProjectContext,
+    config: &CompilerConfig,
+    extra_roots: &[PathBuf],
+    records: Vec<PersistedRecord>,
+  ) -> Self {
+    let mut graph = Self::skeleton(context, config, extra_roots);
+    for record in records {
+      graph.files.insert(
+        record.path,
+        FileRecord {
+          digest: blake3::Hash::from(record.digest),
+          imports: record.imports,
+        },
+      );
+    }
+    graph
+  }
+
+  fn skeleton(context: &ProjectContext, config: &CompilerConfig, extra_roots: &[PathBuf]) -> Self {
+    let mut roots = vec![context.paths.sources.clone()];
+    for library in &context.paths.libraries {
+      roots.push(library.clone());
+    }
+    roots.extend(extra_roots.iter().cloned());
+    roots.retain(|root| root.exists());
+    roots.dedup();
+
+    let mut resolve_bases = vec![context.root.clone()];
+    resolve_bases.extend(roots.iter().cloned());
+
+    let remappings = config
+      .remappings
+      .iter()
+      .map(|remapping| {
+        let target = PathBuf::from(&remapping.path);
+        let target = if target.is_absolute() {
+          target
+        } else {
+          context.root.join(target)
+        };
+        (remapping.name.clone(), target)
+      })
+      .collect();
+
+    Self {
+      roots,
+      resolve_bases,
+      remappings,
+      files: HashMap::new(),
+    }
+  }
+
+  /// Snapshot the tracked files for persistence, sorted for stable output.
+  pub(crate) fn records(&self) -> Vec<PersistedRecord> {
+    let mut records: Vec<PersistedRecord> = self
+      .files
+      .iter()
+      .map(|(path, record)| PersistedRecord {
+        path: path.clone(),
+        digest: *record.digest.as_bytes(),
+        imports: record.imports.clone(),
+      })
+      .collect();
+    records.sort_by(|a, b| a.path.cmp(&b.path));
+    records
+  }
+
+  /// Expand `seeds` forward over import edges until the set is import-closed, so the result can
+  /// be handed to solc as a self-contained compilation input.
+  pub(crate) fn import_closure(&self, seeds: &[PathBuf]) -> Vec<PathBuf> {
+    let mut closed: BTreeSet<PathBuf> = BTreeSet::new();
+    let mut queue: VecDeque<PathBuf> = seeds.iter().cloned().collect();
+    while let Some(path) = queue.pop_front() {
+      let Some(record) = self.files.get(&path) else {
+        continue;
+      };
+      if !closed.insert(path) {
+        continue;
+      }
+      for import in &record.imports {
+        queue.push_back(import.clone());
+      }
+    }
+    closed.into_iter().collect()
+  }
+
+  /// Diff the watched directories against the previous scan and return the dirty transitive
+  /// closure: every added or edited file plus everything that imports one, directly or through a
+  /// chain. Removed files drop out of the graph but still dirty their importers.
+  pub(crate) fn scan(&mut self) -> Result<Vec<PathBuf>> {
+    let mut seen = BTreeSet::new();
+    let mut changed = BTreeSet::new();
+
+    for root in self.roots.clone() {
+      collect_sources(&root, &mut seen)?;
+    }
+
+    for path in &seen {
+      let contents = std::fs::read(path).map_err(|err| {
+        Error::new(format!(
+          "Failed to read watched source {}: {err}",
+          path.display()
+        ))
+      })?;
+      let digest = blake3::hash(&contents);
+      match self.files.get(path) {
+        Some(record) if record.digest == digest => {}
+        _ => {
+          let source = String::from_utf8_lossy(&contents);
+          let imports = self.resolve_imports(path, &source);
+          self
+            .files
+            .insert(path.clone(), FileRecord { digest, imports });
+          changed.insert(path.clone());
+        }
+      }
+    }
+
+    let removed: Vec<PathBuf> = self
+      .files
+      .keys()
+      .filter(|path| !seen.contains(*path))
+      .cloned()
+      .collect();
+    for path in &removed {
+      self.files.remove(path);
+      changed.insert(path.clone());
+    }
+
+    if changed.is_empty() {
+      return Ok(Vec::new());
+    }
+
+    let mut importers: HashMap<&Path, Vec<&Path>> = HashMap::new();
+    for (path, record) in &self.files {
+      for import in &record.imports {
+        importers
+          .entry(import.as_path())
+          .or_default()
+          .push(path.as_path());
+      }
+    }
+
+    let mut dirty: BTreeSet<PathBuf> = BTreeSet::new();
+    let mut queue: VecDeque<PathBuf> = changed.iter().cloned().collect();
+    while let Some(path) = queue.pop_front() {
+      if !dirty.insert(path.clone()) {
+        continue;
+      }
+      if let Some(dependents) = importers.get(path.as_path()) {
+        for dependent in dependents {
+          queue.push_back(dependent.to_path_buf());
+        }
+      }
+    }
+
+    Ok(
+      dirty
+        .into_iter()
+        .filter(|path| self.files.contains_key(path))
+        .collect(),
+    )
+  }
+
+  /// Paths currently tracked by the graph, sorted for stable output.
+  pub(crate) fn watched_files(&self) -> Vec<PathBuf> {
+    let mut files: Vec<PathBuf> = self.files.keys().cloned().collect();
+    files.sort();
+    files
+  }
+
+  /// Resolve the import directives of `source` to absolute watched paths. Relative imports are
+  /// resolved against the importing file; bare imports are tried through the configured
+  /// remappings and then against the project root and each watched directory. Imports that do not
+  /// land on an existing file produce no edge, which only costs precision for dependencies that
+  /// live outside the watched tree.
+  fn resolve_imports(&self, importer: &Path, source: &str) -> Vec<PathBuf> {
+    let mut imports = Vec::new();
+    for import in shard::import_paths(source) {
+      if let Some(resolved) = self.resolve_import(importer, &import) {
+        imports.push(resolved);
+      }
+    }
+    imports
+  }
+
+  fn resolve_import(&self, importer: &Path, import: &str) -> Option<PathBuf> {
+    if import.starts_with('.') {
+      let base = importer.parent()?;
+      return existing(&normalise(&base.join(import)));
+    }
+
+    for (prefix, target) in &self.remappings {
+      if let Some(stripped) = import.strip_prefix(prefix.as_str()) {
+        if let Some(resolved) = existing(&normalise(&target.join(stripped))) {
+          return Some(resolved);
+        }
+      }
+    }
+
+    for base in &self.resolve_bases {
+      if let Some(resolved) = existing(&normalise(&base.join(import))) {
+        return Some(resolved);
+      }
+    }
+
+    None
+  }
+}
+
+fn existing(path: &Path) -> Option<PathBuf> {
+  if path.is_file() {
+    Some(path.to_path_buf())
+  } else {
+    None
+  }
+}
+
+/// Lexically normalise `.` and `..` segments so resolved imports compare equal to scanned paths
+/// without touching the filesystem.
+fn normalise(path: &Path) -> PathBuf {
+  let mut result = PathBuf::new();
+  for component in path.components() {
+    match component {
+      std::path::Component::CurDir => {}
+      std::path::Component::ParentDir => {
+        result.pop();
+      }
+      other => result.push(other),
+    }
+  }
+  result
+}
+
+fn collect_sources(dir: &Path, seen: &mut BTreeSet<PathBuf>) -> Result<()> {
+  let entries = match std::fs::read_dir(dir) {
+    Ok(entries) => entries,
+    Err(_) => return Ok(()),
+  };
+  for entry in entries.flatten() {
+    let path = entry.path();
+    let Some(name) = path.file_name().and_then(|name| name.to_str()) else {
+      continue;
+    };
+    if name.starts_with('.') || name == "node_modules" {
+      continue;
+    }
+    if path.is_dir() {
+      collect_sources(&path, seen)?;
+    } else if path
+      .extension()
+      .and_then(|ext| ext.to_str())
+      .map(|ext| WATCHED_EXTENSIONS.contains(&ext))
+      .unwrap_or(false)
+    {
+      seen.insert(path);
+    }
+  }
+  Ok(())
+}
+
+struct WatcherInner {
+  config: CompilerConfig,
+  graph: Mutex<WatchGraph>,
+  poll_interval: Duration,
+  stopped: AtomicBool,
+  thread: Mutex<Option<JoinHandle<()>>>,
+}
+
+impl WatcherInner {
+  /// One watch tick: rescan, and when the dirty closure is non-empty recompile exactly those
+  /// files. Returns `None` when nothing changed.
+  fn poll_once(&self) -> Result<Option<CompileOutput>> {
+    let dirty = {
+      let mut graph = self
+        .graph
+        .lock()
+        .map_err(|err| Error::new(format!("Watcher graph mutex poisoned: {err}")))?;
+      graph.scan()?
+    };
+    if dirty.is_empty() {
+      return Ok(None);
+    }
+
+    let started = Instant::now();
+    info!(
+      target: LOG_TARGET,
+      "recompiling {} dirty file(s)",
+      dirty.len()
+    );
+    let output = compile_files(&self.config, dirty, None)?;
+    info!(
+      target: LOG_TARGET,
+      "incremental rebuild finished diagnostics={} duration={:?}",
+      output.errors.len(),
+      started.elapsed()
+    );
+    Ok(Some(output))
+  }
+}
+
+/// Long-lived incremental recompilation service bound to a project compiler. The watcher keeps
+/// the project's import graph in memory and, on every poll, recompiles only the files whose
+/// contents changed plus their transitive importers — the dirty closure — instead of re-running a
+/// full project build. Drive it manually with `poll()` or hand it a callback via `watch()` to get
+/// deltas pushed from a background thread.
+#[napi(js_name = "CompilerWatcher")]
+pub struct JsCompilerWatcher {
+  inner: Arc<WatcherInner>,
+}
+
+impl JsCompilerWatcher {
+  pub(crate) fn create(
+    context: &ProjectContext,
+    config: CompilerConfig,
+    poll_interval_ms: Option<u32>,
+  ) -> Result<Self> {
+    let graph = WatchGraph::from_project(context, &config)?;
+    info!(
+      target: LOG_TARGET,
+      "watching {} source file(s) under {}",
+      graph.watched_files().len(),
+      context.root.display()
+    );
+    Ok(Self {
+      inner: Arc::new(WatcherInner {
+        config,
+        graph: Mutex::new(graph),
+        poll_interval: Duration::from_millis(u64::from(
+          poll_interval_ms.unwrap_or(DEFAULT_POLL_INTERVAL_MS).max(1),
+        )),
+        stopped: AtomicBool::new(false),
+        thread: Mutex::new(None),
+      }),
+    })
+  }
+}
+
+#[napi]
+impl JsCompilerWatcher {
+  /// Rescan the watched directories once and recompile the dirty transitive closure. Returns
+  /// `null` when no watched file changed since the previous scan.
+  #[napi(ts_return_type = "CompileOutput<true, string[]> | CompileOutput<false, string[]> | null")]
+  pub fn poll(&self) -> napi::Result<Option<JsCompileOutput>> {
+    let output = to_napi_result(self.inner.poll_once())?;
+    Ok(output.map(into_js_compile_output))
+  }
+
+  /// Start a background thread that polls at the configured interval and invokes `callback` with
+  /// each incremental `CompileOutput` delta (or an error when a rebuild fails). Only one watch
+  /// loop may be active per watcher.
+  #[napi(
+    ts_args_type = "callback: (err: Error | null, output: CompileOutput<true, string[]> | CompileOutput<false, string[]>) => void"
+  )]
+  pub fn watch(&self, callback: JsFunction) -> napi::Result<()> {
+    let tsfn: ThreadsafeFunction<CompileOutput> =
+      callback.create_threadsafe_function(0, |ctx| Ok(vec![into_js_compile_output(ctx.value)]))?;
+
+    let mut thread = self
+      .inner
+      .thread
+      .lock()
+      .map_err(|err| napi_error(format!("Watcher thread mutex poisoned: {err}")))?;
+    if thread.is_some() {
+      return Err(napi_error(
+        "Watcher is already running. Call stop() before starting another watch loop.",
+      ));
+    }
+
+    self.inner.stopped.store(false, Ordering::SeqCst);
+    let inner = Arc::clone(&self.inner);
+    *thread = Some(std::thread::spawn(move || {
+      while !inner.stopped.load(Ordering::SeqCst) {
+        std::thread::sleep(inner.poll_interval);
+        if inner.stopped.load(Ordering::SeqCst) {
+          break;
+        }
+        match inner.poll_once() {
+          Ok(None) => {}
+          Ok(Some(output)) => {
+            tsfn.call(Ok(output), ThreadsafeFunctionCallMode::NonBlocking);
+          }
+          Err(err) => {
+            error!(target: LOG_TARGET, "incremental rebuild failed: {}", err);
+            tsfn.call(
+              Err(napi_error(err.to_string())),
+              ThreadsafeFunctionCallMode::NonBlocking,
+            );
+          }
+        }
+      }
+    }));
+    Ok(())
+  }
+
+  /// Stop the background watch loop, blocking until the thread exits. The watcher can be
+  /// restarted with another `watch()` call, and `poll()` keeps working either way.
+  #[napi]
+  pub fn stop(&self) -> napi::Result<()> {
+    self.inner.stopped.store(true, Ordering::SeqCst);
+    let handle = self
+      .inner
+      .thread
+      .lock()
+      .map_err(|err| napi_error(format!("Watcher thread mutex poisoned: {err}")))?
+      .take();
+    if let Some(handle) = handle {
+      handle
+        .join()
+        .map_err(|_| napi_error("Watcher thread panicked while stopping."))?;
+    }
+    Ok(())
+  }
+
+  /// Absolute paths of every source file currently tracked by the import graph.
+  #[napi(getter)]
+  pub fn watched_paths(&self) -> napi::Result<Vec<String>> {
+    let graph = self
+      .inner
+      .graph
+      .lock()
+      .map_err(|err| napi_error(format!("Watcher graph mutex poisoned: {err}")))?;
+    Ok(
+      graph
+        .watched_files()
+        .iter()
+        .map(|path| path.display().to_string())
+        .collect(),
+    )
+  }
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+  use crate::internal::project::create_synthetic_context;
+  use tempfile::tempdir;
+
+  fn graph_for(root: &Path) -> WatchGraph {
+    let context = create_synthetic_context(root).expect("context");
+    WatchGraph::from_project(&context, &CompilerConfig::default()).expect("graph")
+  }
+
+  #[test]
+  fn unchanged_tree_reports_no_dirty_files() {
+    let temp = tempdir().expect("tempdir");
+    std::fs::write(temp.path().join("A.sol"), "contract A {}").expect("write");
+
+    let mut graph = graph_for(temp.path());
+    assert!(graph.scan().expect("scan").is_empty());
+  }
+
+  #[test]
+  fn editing_a_file_dirties_its_transitive_importers() {
+    let temp = tempdir().expect("tempdir");
+    let root = temp.path();
+    std::fs::write(root.join("A.sol"), "import \"./B.sol\";\ncontract A {}").expect("write");
+    std::fs::write(root.join("B.sol"), "import \"./C.sol\";\ncontract B {}").expect("write");
+    std::fs::write(root.join("C.sol"), "contract C {}").expect("write");
+    std::fs::write(root.join("D.sol"), "contract D {}").expect("write");
+
+    let mut graph = graph_for(root);
+    std::fs::write(root.join("C.sol"), "contract C { uint256 x; }").expect("rewrite");
+
+    let dirty = graph.scan().expect("scan");
+    let names: Vec<_> = dirty
+      .iter()
+      .filter_map(|path| path.file_name().and_then(|name| name.to_str()))
+      .collect();
+    assert_eq!(names, vec!["A.sol", "B.sol", "C.sol"]);
+  }
+
+  #[test]
+  fn added_and_removed_files_update_the_graph() {
+    let temp = tempdir().expect("tempdir");
+    let root = temp.path();
+    std::fs::write(root.join("A.sol"), "import \"./B.sol\";\ncontract A {}").expect("write");
+    std::fs::write(root.join("B.sol"), "contract B {}").expect("write");
+
+    let mut graph = graph_for(root);
+
+    std::fs::write(root.join("C.sol"), "contract C {}").expect("write");
+    let dirty = graph.scan().expect("scan after add");
+    assert_eq!(dirty.len(), 1);
+    assert!(dirty[0].ends_with("C.sol"));
+
+    std::fs::remove_file(root.join("B.sol")).expect("remove");
+    let dirty = graph.scan().expect("scan after remove");
+    assert_eq!(dirty.len(), 1);
+    assert!(dirty[0].ends_with("A.sol"));
+    assert!(graph
+      .watched_files()
+      .iter()
+      .all(|path| !path.ends_with("B.sol")));
+  }
+
+  #[test]
+  fn persisted_records_detect_changes_across_instances() {
+    let temp = tempdir().expect("tempdir");
+    let root = temp.path();
+    std::fs::write(root.join("A.sol"), "import \"./B.sol\";\ncontract A {}").expect("write");
+    std::fs::write(root.join("B.sol"), "contract B {}").expect("write");
+
+    let records = graph_for(root).records();
+    assert_eq!(records.len(), 2);
+
+    std::fs::write(root.join("B.sol"), "contract B { uint256 x; }").expect("rewrite");
+
+    let context = create_synthetic_context(root).expect("context");
+    let mut restored = WatchGraph::from_records(&context, &CompilerConfig::default(), &[], records);
+    let dirty = restored.scan().expect("scan");
+    let names: Vec<_> = dirty
+      .iter()
+      .filter_map(|path| path.file_name().and_then(|name| name.to_str()))
+      .collect();
+    assert_eq!(names, vec!["A.sol", "B.sol"]);
+    assert!(restored.scan().expect("rescan").is_empty());
+  }
+
+  #[test]
+  fn import_closure_expands_seeds_forward_over_imports() {
+    let temp = tempdir().expect("tempdir");
+    let root = temp.path();
+    std::fs::write(root.join("A.sol"), "import \"./B.sol\";\ncontract A {}").expect("write");
+    std::fs::write(root.join("B.sol"), "import \"./C.sol\";\ncontract B {}").expect("write");
+    std::fs::write(root.join("C.sol"), "contract C {}").expect("write");
+    std::fs::write(root.join("D.sol"), "contract D {}").expect("write");
+
+    let graph = graph_for(root);
+    let closure = graph.import_closure(&[root.join("B.sol")]);
+    let names: Vec<_> = closure
+      .iter()
+      .filter_map(|path| path.file_name().and_then(|name| name.to_str()))
+      .collect();
+    assert_eq!(names, vec!["B.sol", "C.sol"]);
+  }
+}
@@ -1,4 +1,5 @@
 use std::collections::{BTreeMap, HashMap};
+use std::sync::{Arc, OnceLock};
 
 use foundry_compilers::artifacts::{
   bytecode::{
@@ -9,24 +10,29 @@ use foundry_compilers::artifacts::{
 };
 use foundry_compilers::Artifact;
 use hex;
+use serde::de::DeserializeOwned;
 use serde::{Deserialize, Serialize};
 use serde_json::Value;
 
+use crate::internal::hex as fast_hex;
+
+/// Bytecode payload kept behind an `Arc` so snapshots, JS `Buffer` views, and cloned contract
+/// states all share one allocation instead of copying the bytes around.
 #[derive(Clone, Debug, Default, PartialEq, Eq, Serialize, Deserialize)]
 pub struct ContractBytecode {
-  bytes: Vec<u8>,
+  bytes: Arc<Vec<u8>>,
 }
 
 impl ContractBytecode {
   pub fn from_bytes<T: Into<Vec<u8>>>(bytes: T) -> Self {
     Self {
-      bytes: bytes.into(),
+      bytes: Arc::new(bytes.into()),
     }
   }
 
   pub fn from_hex_string(hex_string: &str) -> Result<Self, hex::FromHexError> {
     let trimmed = hex_string.strip_prefix("0x").unwrap_or(hex_string);
-    let bytes = hex::decode(trimmed)?;
+    let bytes = fast_hex::decode(trimmed)?;
     Ok(Self::from_bytes(bytes))
   }
 
@@ -59,8 +65,14 @@ impl ContractBytecode {
     &self.bytes
   }
 
+  /// Shared handle to the underlying byte store. Cloning the `Arc` is what lets JS `Buffer`s
+  /// borrow the bytes without copying while keeping them alive past the wrapper.
+  pub fn shared_bytes(&self) -> Arc<Vec<u8>> {
+    Arc::clone(&self.bytes)
+  }
+
   pub fn into_bytes(self) -> Vec<u8> {
-    self.bytes
+    Arc::try_unwrap(self.bytes).unwrap_or_else(|shared| (*shared).clone())
   }
 
   pub fn is_empty(&self) -> bool {
@@ -72,7 +84,7 @@ impl ContractBytecode {
   }
 
   pub fn to_hex(&self) -> String {
-    format!("0x{}", hex::encode(&self.bytes))
+    format!("0x{}", fast_hex::encode(self.bytes()))
   }
 }
 
@@ -84,7 +96,9 @@ impl AsRef<[u8]> for ContractBytecode {
 
 impl From<Vec<u8>> for ContractBytecode {
   fn from(value: Vec<u8>) -> Self {
-    Self { bytes: value }
+    Self {
+      bytes: Arc::new(value),
+    }
   }
 }
 
@@ -189,13 +203,118 @@ impl From<&Ewasm> for JsEwasm {
   }
 }
 
+/// Analysis-only artifact section kept undecoded until somebody reads it. Sections sourced from
+/// JSON (cache loads, `new Contract(state)` payloads) hold the raw `Value`; the typed form is
+/// produced inside [`LazySection::get`] on first access and memoized in a cell shared by every
+/// clone of the state. Sections built straight from typed compiler output skip the raw stage and
+/// start out decoded, so no path decodes the same data twice.
+#[derive(Debug)]
+pub struct LazySection<T> {
+  /// Undecoded JSON for the section when it was sourced from JSON rather than typed output.
+  raw: Option<Arc<Value>>,
+  /// Memoized decode result. Unset until first access; `Some(None)` when the section is absent or
+  /// its JSON did not match the expected shape.
+  decoded: Arc<OnceLock<Option<Arc<T>>>>,
+}
+
+impl<T> LazySection<T> {
+  /// Section that is not present in the artifact.
+  pub fn absent() -> Self {
+    Self::default()
+  }
+
+  /// Wrap an undecoded JSON section. `None` and JSON `null` both read back as absent.
+  pub fn from_value(value: Option<Value>) -> Self {
+    Self {
+      raw: value.filter(|value| !value.is_null()).map(Arc::new),
+      decoded: Arc::new(OnceLock::new()),
+    }
+  }
+
+  /// Wrap a section that already exists in its typed form; reads never decode anything.
+  pub fn from_decoded(value: Option<T>) -> Self {
+    let decoded = OnceLock::new();
+    let _ = decoded.set(value.map(Arc::new));
+    Self {
+      raw: None,
+      decoded: Arc::new(decoded),
+    }
+  }
+}
+
+impl<T: DeserializeOwned> LazySection<T> {
+  /// Typed view of the section, decoded and memoized on first access. Returns `None` when the
+  /// section is absent or its JSON does not deserialize into `T`.
+  pub fn get(&self) -> Option<&T> {
+    self
+      .decoded
+      .get_or_init(|| {
+        self
+          .raw
+          .as_ref()
+          .and_then(|raw| T::deserialize(raw.as_ref()).ok())
+          .map(Arc::new)
+      })
+      .as_deref()
+  }
+}
+
+impl<T> Default for LazySection<T> {
+  fn default() -> Self {
+    Self {
+      raw: None,
+      decoded: Arc::new(OnceLock::new()),
+    }
+  }
+}
+
+impl<T> Clone for LazySection<T> {
+  fn clone(&self) -> Self {
+    Self {
+      raw: self.raw.clone(),
+      decoded: Arc::clone(&self.decoded),
+    }
+  }
+}
+
+impl<T: Serialize> Serialize for LazySection<T> {
+  fn serialize<S>(&self, serializer: S) -> Result<S::Ok, S::Error>
+  where
+    S: serde::Serializer,
+  {
+    if let Some(raw) = &self.raw {
+      return raw.serialize(serializer);
+    }
+    // Decoded-only sections serialize through `Value` so both backings produce the same encoded
+    // shape and deserialize back into the raw stage uniformly.
+    match self.decoded.get() {
+      Some(Some(value)) => serde_json::to_value(value.as_ref())
+        .unwrap_or(Value::Null)
+        .serialize(serializer),
+      _ => Value::Null.serialize(serializer),
+    }
+  }
+}
+
+impl<'de, T> Deserialize<'de> for LazySection<T> {
+  fn deserialize<D>(deserializer: D) -> Result<Self, D::Error>
+  where
+    D: serde::Deserializer<'de>,
+  {
+    Ok(Self::from_value(Option::<Value>::deserialize(
+      deserializer,
+    )?))
+  }
+}
+
 /// Complete contract snapshot shared between Rust and JavaScript callers. Mirrors the artefact
 /// shape exported from Foundry's standard JSON output.
 #[derive(Clone, Debug, Default, Serialize, Deserialize)]
 #[serde(rename_all = "camelCase")]
 pub struct ContractState {
-  /// Name of the contract as reported by the compiler.
-  pub name: String,
+  /// Name of the contract as reported by the compiler. Interned so the state, the artifact maps,
+  /// and any clones share one allocation per name.
+  pub name: Arc<str>,
   /// Deployed address associated with this artifact, if tracked.
   pub address: Option<String>,
   /// ABI description emitted by the compiler (array or object form depending on compiler version).
@@ -205,7 +324,8 @@ pub struct ContractState {
   /// Deployed bytecode wrapper when available (`deployedBytecode.object`).
   pub deployed_bytecode: Option<ContractBytecode>,
   /// Source file path that emitted the contract, relative to the project root when available.
-  pub source_path: Option<String>,
+  /// Interned alongside the artifact map keys so repeats cost one allocation.
+  pub source_path: Option<Arc<str>>,
   /// Numeric source identifier assigned by solc.
   pub source_id: Option<u32>,
   /// Compiler metadata payload (string or JSON value depending on version).
@@ -216,14 +336,15 @@ pub struct ContractState {
   pub devdoc: Option<Value>,
   /// Storage layout information when requested from the compiler.
   pub storage_layout: Option<Value>,
-  /// Offsets for immutable variables keyed by label (`immutableReferences`).
-  pub immutable_references: Option<BTreeMap<String, Vec<ImmutableSlot>>>,
-  /// Map of function signatures to selectors (`methodIdentifiers`).
-  pub method_identifiers: Option<BTreeMap<String, String>>,
-  /// Function debug metadata keyed by signature.
-  pub function_debug_data: Option<BTreeMap<String, FunctionDebugData>>,
-  /// Gas estimates for deployment and function execution.
-  pub gas_estimates: Option<GasEstimates>,
+  /// Offsets for immutable variables keyed by label (`immutableReferences`), decoded on first
+  /// access.
+  pub immutable_references: LazySection<BTreeMap<String, Vec<ImmutableSlot>>>,
+  /// Map of function signatures to selectors (`methodIdentifiers`), decoded on first access.
+  pub method_identifiers: LazySection<BTreeMap<String, String>>,
+  /// Function debug metadata keyed by signature, decoded on first access.
+  pub function_debug_data: LazySection<BTreeMap<String, FunctionDebugData>>,
+  /// Gas estimates for deployment and function execution, decoded on first access.
+  pub gas_estimates: LazySection<GasEstimates>,
   /// Assembly listing when requested (`evm.assembly` string).
   pub assembly: Option<String>,
   /// Legacy assembly format when emitted by older compiler modes (`evm.legacyAssembly`).
@@ -234,13 +355,13 @@ pub struct ContractState {
   pub ir: Option<String>,
   /// Optimised intermediate representation output when requested (`irOptimized`).
   pub ir_optimized: Option<String>,
-  /// Ewasm output payload when generated.
-  pub ewasm: Option<Ewasm>,
+  /// Ewasm output payload when generated, decoded on first access.
+  pub ewasm: LazySection<Ewasm>,
   pub creation_source_map: Option<String>,
 }
 
 impl ContractState {
-  pub fn new(name: impl Into<String>) -> Self {
+  pub fn new(name: impl Into<Arc<str>>) -> Self {
     Self {
       name: name.into(),
       ..Default::default()
@@ -254,7 +375,7 @@ struct ContractBuilder {
 }
 
 impl ContractBuilder {
-  fn new(name: impl Into<String>) -> Self {
+  fn new(name: impl Into<Arc<str>>) -> Self {
     Self {
       state: ContractState::new(name),
     }
@@ -306,23 +427,26 @@ impl ContractBuilder {
 
   fn set_immutable_references(
     mut self,
-    value: Option<BTreeMap<String, Vec<ImmutableSlot>>>,
+    value: LazySection<BTreeMap<String, Vec<ImmutableSlot>>>,
   ) -> Self {
     self.state.immutable_references = value;
     self
   }
 
-  fn set_method_identifiers(mut self, value: Option<BTreeMap<String, String>>) -> Self {
+  fn set_method_identifiers(mut self, value: LazySection<BTreeMap<String, String>>) -> Self {
     self.state.method_identifiers = value;
     self
   }
 
-  fn set_function_debug_data(mut self, value: Option<BTreeMap<String, FunctionDebugData>>) -> Self {
+  fn set_function_debug_data(
+    mut self,
+    value: LazySection<BTreeMap<String, FunctionDebugData>>,
+  ) -> Self {
     self.state.function_debug_data = value;
     self
   }
 
-  fn set_gas_estimates(mut self, value: Option<GasEstimates>) -> Self {
+  fn set_gas_estimates(mut self, value: LazySection<GasEstimates>) -> Self {
     self.state.gas_estimates = value;
     self
   }
@@ -352,7 +476,7 @@ impl ContractBuilder {
     self
   }
 
-  fn set_ewasm(mut self, value: Option<Ewasm>) -> Self {
+  fn set_ewasm(mut self, value: LazySection<Ewasm>) -> Self {
     self.state.ewasm = value;
     self
   }
@@ -362,14 +486,14 @@ impl ContractBuilder {
   }
 }
 
-pub fn new_state(name: impl Into<String>) -> ContractState {
+pub fn new_state(name: impl Into<Arc<str>>) -> ContractState {
   ContractState::new(name)
 }
 
 pub fn immutable_references_to_js(
   state: &ContractState,
 ) -> Option<HashMap<String, Vec<ImmutableSlot>>> {
-  state.immutable_references.as_ref().map(|map| {
+  state.immutable_references.get().map(|map| {
     map
       .iter()
       .map(|(key, slots)| (key.clone(), slots.clone()))
@@ -378,7 +502,7 @@ pub fn immutable_references_to_js(
 }
 
 pub fn method_identifiers_to_js(state: &ContractState) -> Option<HashMap<String, String>> {
-  state.method_identifiers.as_ref().map(|map| {
+  state.method_identifiers.get().map(|map| {
     map
       .iter()
       .map(|(key, value)| (key.clone(), value.clone()))
@@ -389,7 +513,7 @@ pub fn method_identifiers_to_js(state: &ContractState) -> Option<HashMap<String,
 pub fn function_debug_data_to_js(
   state: &ContractState,
 ) -> Option<HashMap<String, JsFunctionDebugDataEntry>> {
-  state.function_debug_data.as_ref().map(|map| {
+  state.function_debug_data.get().map(|map| {
     map
       .iter()
       .map(|(name, debug)| (name.clone(), JsFunctionDebugDataEntry::from(debug)))
@@ -398,36 +522,36 @@ pub fn function_debug_data_to_js(
 }
 
 pub fn gas_estimates_to_js(state: &ContractState) -> Option<JsGasEstimates> {
-  state.gas_estimates.as_ref().map(JsGasEstimates::from)
+  state.gas_estimates.get().map(JsGasEstimates::from)
 }
 
 pub fn ewasm_to_js(state: &ContractState) -> Option<JsEwasm> {
-  state.ewasm.as_ref().map(JsEwasm::from)
+  state.ewasm.get().map(JsEwasm::from)
 }
 
 pub fn from_foundry_standard_json(
-  name: impl Into<String>,
-  contract: &FoundryContract,
+  name: impl Into<Arc<str>>,
+  contract: FoundryContract,
 ) -> ContractState {
-  build_from_standard_json(&name.into(), contract)
+  build_from_standard_json(name.into(), contract)
 }
 
 pub fn from_configurable_artifact(
-  name: impl Into<String>,
+  name: impl Into<Arc<str>>,
   artifact: &ConfigurableContractArtifact,
 ) -> ContractState {
-  build_from_configurable_artifact(&name.into(), artifact)
+  build_from_configurable_artifact(name.into(), artifact)
 }
 
 pub fn from_foundry_project_artifact(
-  name: impl Into<String>,
+  name: impl Into<Arc<str>>,
   artifact: &impl Artifact,
 ) -> ContractState {
-  build_from_project_artifact(&name.into(), artifact)
+  build_from_project_artifact(name.into(), artifact)
 }
 
-fn build_from_project_artifact(name: &str, artifact: &impl Artifact) -> ContractState {
-  let mut builder = ContractBuilder::new(name.to_string());
+fn build_from_project_artifact(name: Arc<str>, artifact: &impl Artifact) -> ContractState {
+  let mut builder = ContractBuilder::new(name);
   let bytecode_cow = artifact.get_contract_bytecode();
 
   if let Some(abi) = serialize_optional(&bytecode_cow.abi) {
@@ -444,24 +568,33 @@ fn build_from_project_artifact(name: &str, artifact: &impl Artifact) -> Contract
   }
 
   if let Some(deployed) = bytecode_cow.deployed_bytecode.as_ref() {
-    let immutable_refs = deserialize_immutable_refs(&deployed.as_ref().immutable_references);
+    let immutable_refs = raw_immutable_refs(&deployed.as_ref().immutable_references);
     let bytecode = ContractBytecode::from_compact_deployed_bytecode(deployed.as_ref());
     builder = builder
       .set_deployed_bytecode(bytecode)
-      .set_immutable_references(optional_map(immutable_refs));
+      .set_immutable_references(immutable_refs);
   }
 
   builder.finish()
 }
 
-fn build_from_standard_json(name: &str, contract: &FoundryContract) -> ContractState {
-  let mut builder = ContractBuilder::new(name.to_string());
+fn build_from_standard_json(name: Arc<str>, contract: FoundryContract) -> ContractState {
+  let mut builder = ContractBuilder::new(name);
 
   if let Some(abi) = serialize_optional(&contract.abi) {
     builder = builder.set_abi(Some(abi));
   }
 
-  if let Some(evm) = &contract.evm {
+  if let Some(metadata) = contract.metadata.as_ref() {
+    builder = builder.set_metadata(serialize(metadata));
+  }
+
+  builder = builder
+    .set_userdoc(serialize(&contract.userdoc))
+    .set_devdoc(serialize(&contract.devdoc))
+    .set_storage_layout(serialize(&contract.storage_layout));
+
+  if let Some(evm) = contract.evm {
     builder = apply_standard_json_evm(
       builder,
       evm.bytecode.as_ref(),
@@ -469,34 +602,28 @@ fn build_from_standard_json(name: &str, contract: &FoundryContract) -> ContractS
     );
 
     if !evm.method_identifiers.is_empty() {
-      builder = builder.set_method_identifiers(Some(evm.method_identifiers.clone()));
+      builder =
+        builder.set_method_identifiers(LazySection::from_decoded(Some(evm.method_identifiers)));
     }
 
     builder = builder
-      .set_assembly(evm.assembly.clone())
-      .set_legacy_assembly(evm.legacy_assembly.clone())
-      .set_gas_estimates(evm.gas_estimates.clone());
-  }
-
-  if let Some(metadata) = contract.metadata.as_ref() {
-    builder = builder.set_metadata(serialize(metadata));
+      .set_assembly(evm.assembly)
+      .set_legacy_assembly(evm.legacy_assembly)
+      .set_gas_estimates(LazySection::from_decoded(evm.gas_estimates));
   }
 
   builder
-    .set_userdoc(serialize(&contract.userdoc))
-    .set_devdoc(serialize(&contract.devdoc))
-    .set_storage_layout(serialize(&contract.storage_layout))
-    .set_ir(contract.ir.clone())
-    .set_ir_optimized(contract.ir_optimized.clone())
-    .set_ewasm(contract.ewasm.clone())
+    .set_ir(contract.ir)
+    .set_ir_optimized(contract.ir_optimized)
+    .set_ewasm(LazySection::from_decoded(contract.ewasm))
     .finish()
 }
 
 fn build_from_configurable_artifact(
-  name: &str,
+  name: Arc<str>,
   artifact: &ConfigurableContractArtifact,
 ) -> ContractState {
-  let mut builder = ContractBuilder::new(name.to_string());
+  let mut builder = ContractBuilder::new(name);
 
   if let Some(abi) = serialize_optional(&artifact.abi) {
     builder = builder.set_abi(Some(abi));
@@ -527,15 +654,19 @@ fn build_from_configurable_artifact(
   }
 
   builder = builder
-    .set_function_debug_data(artifact.function_debug_data.clone())
-    .set_gas_estimates(artifact.gas_estimates.clone())
+    .set_function_debug_data(LazySection::from_decoded(
+      artifact.function_debug_data.clone(),
+    ))
+    .set_gas_estimates(LazySection::from_decoded(artifact.gas_estimates.clone()))
     .set_assembly(artifact.assembly.clone())
     .set_legacy_assembly(artifact.legacy_assembly.clone())
     .set_opcodes(artifact.opcodes.clone())
-    .set_method_identifiers(artifact.method_identifiers.clone())
+    .set_method_identifiers(LazySection::from_decoded(
+      artifact.method_identifiers.clone(),
+    ))
     .set_ir(artifact.ir.clone())
     .set_ir_optimized(artifact.ir_optimized.clone())
-    .set_ewasm(artifact.ewasm.clone());
+    .set_ewasm(LazySection::from_decoded(artifact.ewasm.clone()));
 
   if let Some(id) = artifact.id {
     builder = builder.set_source_id(Some(id));
@@ -558,10 +689,10 @@ fn apply_standard_json_evm(
 
   if let Some(deployed) = deployed {
     let bytecode = ContractBytecode::from_deployed_bytecode(deployed);
-    let immutable_refs = deserialize_immutable_refs(&deployed.immutable_references);
+    let immutable_refs = raw_immutable_refs(&deployed.immutable_references);
     builder = builder
       .set_deployed_bytecode(bytecode)
-      .set_immutable_references(optional_map(immutable_refs));
+      .set_immutable_references(immutable_refs);
   }
 
   builder
@@ -581,10 +712,10 @@ fn apply_compact_evm_artifacts(
 
   if let Some(deployed) = deployed {
     let bytecode = ContractBytecode::from_compact_deployed_bytecode(deployed);
-    let immutable_refs = deserialize_immutable_refs(&deployed.immutable_references);
+    let immutable_refs = raw_immutable_refs(&deployed.immutable_references);
     builder = builder
       .set_deployed_bytecode(bytecode)
-      .set_immutable_references(optional_map(immutable_refs));
+      .set_immutable_references(immutable_refs);
   }
 
   builder
@@ -598,24 +729,18 @@ fn serialize_optional<T: Serialize>(value: &Option<T>) -> Option<Value> {
   value.as_ref().and_then(serialize)
 }
 
-fn optional_map<K, V>(map: BTreeMap<K, V>) -> Option<BTreeMap<K, V>> {
-  if map.is_empty() {
-    None
-  } else {
-    Some(map)
-  }
-}
-
-pub fn deserialize_immutable_refs<T>(
+/// Capture the compiler's `immutableReferences` section as raw JSON. Converting each slot list
+/// into [`ImmutableSlot`] values is deferred until somebody reads the section.
+fn raw_immutable_refs<T>(
   source: &BTreeMap<String, Vec<T>>,
-) -> BTreeMap<String, Vec<ImmutableSlot>>
+) -> LazySection<BTreeMap<String, Vec<ImmutableSlot>>>
 where
   T: Serialize,
 {
-  serde_json::to_value(source)
-    .ok()
-    .and_then(|value| serde_json::from_value(value).ok())
-    .unwrap_or_default()
+  if source.is_empty() {
+    return LazySection::absent();
+  }
+  LazySection::from_value(serde_json::to_value(source).ok())
 }
 
 #[cfg(test)]
@@ -638,6 +763,18 @@ mod tests {
     assert_eq!(bytecode.to_hex(), "0x60006001");
   }
 
+  #[test]
+  fn contract_bytecode_clones_share_one_allocation() {
+    let bytecode = ContractBytecode::from_bytes(vec![0x60, 0x00]);
+    let clone = bytecode.clone();
+    assert_eq!(bytecode.bytes().as_ptr(), clone.bytes().as_ptr());
+    assert_eq!(
+      bytecode.shared_bytes().as_ptr(),
+      clone.shared_bytes().as_ptr()
+    );
+    assert_eq!(clone.into_bytes(), vec![0x60, 0x00]);
+  }
+
   #[test]
   fn contract_state_setters_cover_all_fields() {
     let mut state = ContractState::new("Fixture");
@@ -648,47 +785,41 @@ mod tests {
     state.userdoc = Some(json!({ "notice": "hi" }));
     state.devdoc = Some(json!({ "details": "yo" }));
     state.storage_layout = Some(json!({ "storage": [] }));
-    state.immutable_references = Some(BTreeMap::from([(
+    state.immutable_references = LazySection::from_decoded(Some(BTreeMap::from([(
       "slot".to_string(),
       vec![ImmutableSlot {
         start: 0,
         length: 32,
       }],
-    )]));
-    state.function_debug_data = Some(BTreeMap::from([(
-      "foo()".to_string(),
-      serde_json::from_value(json!({
+    )])));
+    state.function_debug_data = LazySection::from_value(Some(json!({
+      "foo()": {
         "entryPoint": 0,
         "id": 0,
         "parameterSlots": 0,
         "returnSlots": 0
-      }))
-      .expect("debug"),
-    )]));
-    state.gas_estimates = Some(
-      serde_json::from_value(json!({
-        "creation": {
-          "codeDepositCost": "1",
-          "executionCost": "2",
-          "totalCost": "3"
-        },
-        "external": {},
-        "internal": {}
-      }))
-      .expect("gas"),
-    );
+      }
+    })));
+    state.gas_estimates = LazySection::from_value(Some(json!({
+      "creation": {
+        "codeDepositCost": "1",
+        "executionCost": "2",
+        "totalCost": "3"
+      },
+      "external": {},
+      "internal": {}
+    })));
     state.assembly = Some("assembly".into());
     state.legacy_assembly = Some(json!({ "legacy": true }));
     state.opcodes = Some("PUSH1 0x00".into());
     state.ir = Some("ir".into());
     state.ir_optimized = Some("optimized".into());
-    state.ewasm =
-      Some(serde_json::from_value(json!({ "wasm": "0x00", "wast": null })).expect("ewasm"));
+    state.ewasm = LazySection::from_value(Some(json!({ "wasm": "0x00", "wast": null })));
     state.creation_source_map = Some("0:0:0".into());
     state.source_path = Some("src/Fixture.sol".into());
     state.source_id = Some(7);
 
-    assert_eq!(state.name, "Fixture");
+    assert_eq!(&*state.name, "Fixture");
     assert_eq!(state.address.as_deref(), Some("0xabc"));
     assert_eq!(
       state.metadata.as_ref().and_then(|v| v.get("metadata")),
@@ -697,15 +828,15 @@ mod tests {
     assert!(state.userdoc.is_some());
     assert!(state.devdoc.is_some());
     assert!(state.storage_layout.is_some());
-    assert!(state.immutable_references.is_some());
-    assert!(state.function_debug_data.is_some());
-    assert!(state.gas_estimates.is_some());
+    assert!(state.immutable_references.get().is_some());
+    assert!(state.function_debug_data.get().is_some());
+    assert!(state.gas_estimates.get().is_some());
     assert_eq!(state.assembly.as_deref(), Some("assembly"));
     assert!(state.legacy_assembly.is_some());
     assert_eq!(state.opcodes.as_deref(), Some("PUSH1 0x00"));
     assert_eq!(state.ir.as_deref(), Some("ir"));
     assert_eq!(state.ir_optimized.as_deref(), Some("optimized"));
-    assert!(state.ewasm.is_some());
+    assert!(state.ewasm.get().is_some());
     assert_eq!(state.creation_source_map.as_deref(), Some("0:0:0"));
     assert_eq!(state.source_path.as_deref(), Some("src/Fixture.sol"));
     assert_eq!(state.source_id, Some(7));
@@ -747,18 +878,17 @@ mod tests {
     }"#;
 
     let contract: FoundryContract = serde_json::from_str(json).expect("contract");
-    let state = from_foundry_standard_json("Sample", &contract);
-    assert_eq!(state.name, "Sample");
+    let state = from_foundry_standard_json("Sample", contract);
+    assert_eq!(&*state.name, "Sample");
     assert!(state.abi.is_some());
     assert!(state
       .creation_bytecode
       .as_ref()
       .is_some_and(|b| !b.is_empty()));
-    assert!(state.method_identifiers.is_some());
-    assert!(state.immutable_references.is_some());
+    assert!(state.method_identifiers.get().is_some());
     assert_eq!(state.creation_source_map.as_deref(), Some("00"));
-    assert!(state.gas_estimates.is_some());
-    let refs = state.immutable_references.as_ref().expect("immutable refs");
+    assert!(state.gas_estimates.get().is_some());
+    let refs = state.immutable_references.get().expect("immutable refs");
     let slots = refs.get("").expect("slot list");
     assert_eq!(slots[0].start, 0);
     assert_eq!(slots[0].length, 20);
@@ -808,22 +938,21 @@ mod tests {
 
     let artifact: ConfigurableContractArtifact = serde_json::from_str(json).expect("artifact");
     let state = from_configurable_artifact("Library", &artifact);
-    assert_eq!(state.name, "Library");
+    assert_eq!(&*state.name, "Library");
     assert_eq!(state.source_id, Some(7));
     assert!(state.metadata.is_some());
     assert!(state.userdoc.is_some());
     assert!(state.devdoc.is_some());
-    assert!(state.method_identifiers.is_some());
-    assert!(state.immutable_references.is_some());
+    assert!(state.method_identifiers.get().is_some());
     assert_eq!(state.creation_source_map.as_deref(), Some("11"));
-    assert!(state.function_debug_data.is_some());
-    assert!(state.gas_estimates.is_some());
-    assert!(state.ewasm.is_some());
+    assert!(state.function_debug_data.get().is_some());
+    assert!(state.gas_estimates.get().is_some());
+    assert!(state.ewasm.get().is_some());
     assert!(state
       .creation_bytecode
       .as_ref()
       .is_some_and(|b| !b.is_empty()));
-    let refs = state.immutable_references.as_ref().expect("immutable refs");
+    let refs = state.immutable_references.get().expect("immutable refs");
     let slots = refs.get("").expect("slot list");
     assert_eq!(slots[0].start, 1);
     assert_eq!(slots[0].length, 32);
@@ -840,25 +969,55 @@ mod tests {
     }"#;
 
     let contract: FoundryContract = serde_json::from_str(json).expect("contract");
-    let state = from_foundry_standard_json("Minimal", &contract);
+    let state = from_foundry_standard_json("Minimal", contract);
 
-    assert_eq!(state.name, "Minimal");
+    assert_eq!(&*state.name, "Minimal");
     assert!(state.creation_bytecode.is_some());
     assert!(state.metadata.is_none());
-    assert!(state.method_identifiers.is_none());
-    assert!(state.gas_estimates.is_none());
+    assert!(state.method_identifiers.get().is_none());
+    assert!(state.gas_estimates.get().is_none());
   }
 
   #[test]
-  fn deserialize_immutable_refs_returns_structured_slots() {
-    let source = BTreeMap::from([(
-      "slot".to_string(),
-      vec![serde_json::json!({ "start": 4, "length": 32 })],
-    )]);
-    let converted = deserialize_immutable_refs(&source);
-    let slots = converted.get("slot").expect("slot entries");
-    assert_eq!(slots.len(), 1);
-    assert_eq!(slots[0].start, 4);
-    assert_eq!(slots[0].length, 32);
+  fn lazy_section_decodes_once_and_shares_the_memo_across_clones() {
+    let section: LazySection<BTreeMap<String, String>> = LazySection::from_value(Some(json!({
+      "greet()": "0xabcdef01"
+    })));
+    let clone = section.clone();
+
+    let decoded = clone.get().expect("decoded map");
+    assert_eq!(
+      decoded.get("greet()").map(String::as_str),
+      Some("0xabcdef01")
+    );
+    // Both handles resolve to the same memoized allocation; the decode ran exactly once.
+    assert!(std::ptr::eq(section.get().expect("decoded map"), decoded));
+  }
+
+  #[test]
+  fn lazy_section_treats_null_and_mismatched_json_as_absent() {
+    let null: LazySection<GasEstimates> = LazySection::from_value(Some(Value::Null));
+    assert!(null.get().is_none());
+
+    let mismatched: LazySection<GasEstimates> = LazySection::from_value(Some(json!("not gas")));
+    assert!(mismatched.get().is_none());
+  }
+
+  #[test]
+  fn lazy_section_serializes_identically_from_raw_and_decoded_backings() {
+    let payload = json!({ "wasm": "0x00", "wast": "(module)" });
+    let raw: LazySection<Ewasm> = LazySection::from_value(Some(payload.clone()));
+    let decoded: LazySection<Ewasm> =
+      LazySection::from_decoded(Some(serde_json::from_value(payload).expect("ewasm")));
+
+    let raw_json = serde_json::to_value(&raw).expect("raw json");
+    let decoded_json = serde_json::to_value(&decoded).expect("decoded json");
+    assert_eq!(raw_json, decoded_json);
+
+    let reloaded: LazySection<Ewasm> = serde_json::from_value(decoded_json).expect("reload");
+    assert_eq!(
+      reloaded.get().map(|ewasm| ewasm.wasm.as_str()),
+      Some("0x00")
+    );
   }
 }
@@ -11,13 +11,15 @@ use foundry_compilers::artifacts::ConfigurableContractArtifact;
 use foundry_compilers::Artifact;
 use log::info;
 use napi::bindgen_prelude::*;
-use napi::{Either, JsUnknown, ValueType};
+use napi::{Either, JsBuffer, JsUnknown, ValueType};
 use serde::{Deserialize, Serialize};
 use serde_json::Value;
 use std::collections::HashMap;
+use std::sync::Arc;
 
 pub use core::{
-  ContractBytecode, ContractState, ImmutableSlot, JsEwasm, JsFunctionDebugDataEntry, JsGasEstimates,
+  ContractBytecode, ContractState, ImmutableSlot, JsEwasm, JsFunctionDebugDataEntry,
+  JsGasEstimates, LazySection,
 };
 
 const LOG_TARGET: &str = "tevm::contract";
@@ -27,14 +29,15 @@ const LOG_TARGET: &str = "tevm::contract";
 // -----------------------------------------------------------------------------
 
 /// Mutable Rust wrapper around the compiler-emitted contract state.
-#[derive(Clone, Debug, Default)]
+#[derive(Clone, Debug, Default, serde::Serialize, serde::Deserialize)]
+#[serde(transparent)]
 pub struct Contract {
   state: ContractState,
 }
 
 impl Contract {
   /// Create a new contract snapshot with only its name populated.
-  pub fn new(name: impl Into<String>) -> Self {
+  pub fn new(name: impl Into<Arc<str>>) -> Self {
     let name = name.into();
     info!(target: LOG_TARGET, "initialising contract state for {name}");
     Self {
@@ -42,10 +45,11 @@ impl Contract {
     }
   }
 
-  /// Construct from a standard JSON artifact generated by Solc.
+  /// Construct from a standard JSON artifact generated by Solc. Takes the artifact by value so
+  /// analysis sections move into the state instead of being cloned per contract.
   pub fn from_foundry_standard_json(
-    name: impl Into<String>,
-    contract: &foundry_compilers::artifacts::contract::Contract,
+    name: impl Into<Arc<str>>,
+    contract: foundry_compilers::artifacts::contract::Contract,
   ) -> Self {
     let name = name.into();
     info!(
@@ -60,7 +64,7 @@ impl Contract {
 
   /// Construct from a configurable artifact produced by a Foundry multi-compiler project.
   pub fn from_configurable_artifact(
-    name: impl Into<String>,
+    name: impl Into<Arc<str>>,
     artifact: &ConfigurableContractArtifact,
   ) -> Self {
     let name = name.into();
@@ -75,7 +79,10 @@ impl Contract {
   }
 
   /// Construct from any Foundry project artifact surfaced through the artifact graph.
-  pub fn from_foundry_project_artifact(name: impl Into<String>, artifact: &impl Artifact) -> Self {
+  pub fn from_foundry_project_artifact(
+    name: impl Into<Arc<str>>,
+    artifact: &impl Artifact,
+  ) -> Self {
     let name = name.into();
     info!(
       target: LOG_TARGET,
@@ -266,10 +273,10 @@ pub fn contract_class(contract: &Contract) -> JsContract {
 
 pub fn contract_state_to_js(state: &ContractState) -> JsContractState {
   JsContractState {
-    name: state.name.clone(),
+    name: state.name.to_string(),
     address: state.address.clone(),
     abi: state.abi.clone(),
-    source_path: state.source_path.clone(),
+    source_path: state.source_path.as_deref().map(str::to_string),
     source_id: state.source_id,
     creation_bytecode: state
       .creation_bytecode
@@ -315,7 +322,10 @@ fn contract_state_from_json_value(value: &Value) -> napi::Result<ContractState>
   let mut state = ContractState::new(name);
   state.address = obj.get("address").and_then(value_to_string);
   state.abi = clone_non_null(obj.get("abi"));
-  state.source_path = obj.get("sourcePath").and_then(value_to_string);
+  state.source_path = obj
+    .get("sourcePath")
+    .and_then(value_to_string)
+    .map(Into::into);
   state.source_id = obj
     .get("sourceId")
     .and_then(Value::as_u64)
@@ -326,26 +336,16 @@ fn contract_state_from_json_value(value: &Value) -> napi::Result<ContractState>
   state.userdoc = clone_non_null(obj.get("userdoc"));
   state.devdoc = clone_non_null(obj.get("devdoc"));
   state.storage_layout = clone_non_null(obj.get("storageLayout"));
-  state.immutable_references = obj
-    .get("immutableReferences")
-    .and_then(|value| serde_json::from_value(value.clone()).ok());
-  state.method_identifiers = obj
-    .get("methodIdentifiers")
-    .and_then(|value| serde_json::from_value(value.clone()).ok());
-  state.function_debug_data = obj
-    .get("functionDebugData")
-    .and_then(|value| serde_json::from_value(value.clone()).ok());
-  state.gas_estimates = obj
-    .get("gasEstimates")
-    .and_then(|value| serde_json::from_value(value.clone()).ok());
+  state.immutable_references = LazySection::from_value(obj.get("immutableReferences").cloned());
+  state.method_identifiers = LazySection::from_value(obj.get("methodIdentifiers").cloned());
+  state.function_debug_data = LazySection::from_value(obj.get("functionDebugData").cloned());
+  state.gas_estimates = LazySection::from_value(obj.get("gasEstimates").cloned());
   state.assembly = obj.get("assembly").and_then(value_to_string);
   state.legacy_assembly = clone_non_null(obj.get("legacyAssembly"));
   state.opcodes = obj.get("opcodes").and_then(value_to_string);
   state.ir = obj.get("ir").and_then(value_to_string);
   state.ir_optimized = obj.get("irOptimized").and_then(value_to_string);
-  state.ewasm = obj
-    .get("ewasm")
-    .and_then(|value| serde_json::from_value(value.clone()).ok());
+  state.ewasm = LazySection::from_value(obj.get("ewasm").cloned());
   state.creation_source_map = obj.get("creationSourceMap").and_then(value_to_string);
 
   Ok(state)
@@ -365,6 +365,21 @@ fn clone_non_null(value: Option<&Value>) -> Option<Value> {
   })
 }
 
+/// Expose a bytecode payload as a Node `Buffer` backed by the shared native byte store. The `Arc`
+/// clone handed over as the finalize hint keeps the allocation alive until the JS garbage
+/// collector releases the `Buffer`, so no bytes are copied or hex-encoded on the way out.
+fn bytecode_to_buffer(env: &Env, bytecode: &ContractBytecode) -> napi::Result<JsBuffer> {
+  let bytes = bytecode.shared_bytes();
+  if bytes.is_empty() {
+    return Ok(env.create_buffer(0)?.into_raw());
+  }
+
+  let data = bytes.as_ptr() as *mut u8;
+  let length = bytes.len();
+  unsafe { env.create_buffer_with_borrowed_data(data, length, bytes, |hint, _env| drop(hint)) }
+    .map(|value| value.into_raw())
+}
+
 fn json_to_bytecode(value: Option<&Value>) -> napi::Result<Option<ContractBytecode>> {
   let Some(value) = value else {
     return Ok(None);
@@ -479,7 +494,7 @@ impl JsContract {
       .map_err(|err| napi_error(format!("Failed to parse contract JSON: {err}")))?;
 
     Ok(Self::from_contract(Contract::from_foundry_standard_json(
-      name, &parsed,
+      name, parsed,
     )))
   }
 
@@ -503,6 +518,27 @@ impl JsContract {
     self.inner.deployed_bytecode().map(JsContractBytecode::from)
   }
 
+  /// Creation bytecode as a `Buffer` sharing the native byte store. Avoids the hex string
+  /// round-trip of `creationBytecode` for callers that feed the bytes straight into a deployer.
+  #[napi(getter, ts_return_type = "Buffer | undefined")]
+  pub fn bytecode_buffer(&self, env: Env) -> napi::Result<Option<JsBuffer>> {
+    self
+      .inner
+      .creation_bytecode()
+      .map(|bytecode| bytecode_to_buffer(&env, bytecode))
+      .transpose()
+  }
+
+  /// Deployed bytecode as a `Buffer` sharing the native byte store.
+  #[napi(getter, ts_return_type = "Buffer | undefined")]
+  pub fn deployed_bytecode_buffer(&self, env: Env) -> napi::Result<Option<JsBuffer>> {
+    self
+      .inner
+      .deployed_bytecode()
+      .map(|bytecode| bytecode_to_buffer(&env, bytecode))
+      .transpose()
+  }
+
   #[napi(getter, ts_return_type = "ContractState['abi']")]
   pub fn abi(&self) -> Option<Value> {
     self.inner.state().abi.clone()
@@ -1,6 +1,7 @@
-use std::collections::{BTreeMap, BTreeSet};
+use std::collections::{BTreeMap, BTreeSet, HashMap};
 use std::path::PathBuf;
 use std::str::FromStr;
+use std::sync::{Mutex, OnceLock};
 
 use foundry_compilers::artifacts::vyper::{VyperOptimizationMode, VyperSettings};
 use foundry_compilers::artifacts::{
@@ -15,11 +16,11 @@ use crate::internal::errors::{map_napi_error, napi_error};
 use crate::internal::logging::LoggingLevel;
 use crate::internal::path::{to_path_set, to_path_vec};
 use crate::internal::settings::{
-  default_output_selection, merge_settings, sanitize_settings, CompilerSettingsOptions,
-  JsCompilerSettingsOptions, VyperSettingsOptions,
+  default_output_selection, merge_settings, minimal_output_selection, sanitize_settings,
+  CompilerSettingsOptions, JsCompilerSettingsOptions, VyperSettingsOptions,
 };
 
-#[derive(Clone, Copy, Debug, Eq, PartialEq)]
+#[derive(Clone, Copy, Debug, Eq, PartialEq, serde::Serialize, serde::Deserialize)]
 pub enum CompilerLanguage {
   Solidity,
   Yul,
@@ -161,6 +162,12 @@ pub struct CompilerConfig {
   pub slash_paths: bool,
   /// Explicit solc job count override. `None` signals that Foundry should choose automatically.
   pub solc_jobs: Option<usize>,
+  /// Maximum number of solc processes the warm handle pool runs concurrently for inline and AST
+  /// compilations. `None` keeps the pool's current capacity (one per logical CPU by default).
+  pub solc_pool_size: Option<usize>,
+  /// Upper bound on compilation shards driven in parallel by `compileFiles`, `compileSources`, and
+  /// project builds. `None` derives the bound from the logical CPU count.
+  pub max_parallel_jobs: Option<usize>,
   /// Emits a reduced artifact payload when `true`, mirroring Foundry's `sparse` output mode.
   pub sparse_output: bool,
   /// Canonicalised paths forwarded to solc's `--allow-paths` flag.
@@ -198,6 +205,8 @@ impl Default for CompilerConfig {
       build_info_enabled: false,
       slash_paths: true,
       solc_jobs: None,
+      solc_pool_size: None,
+      max_parallel_jobs: None,
       sparse_output: false,
       allow_paths: BTreeSet::new(),
       include_paths: BTreeSet::new(),
@@ -219,24 +228,106 @@ impl CompilerConfig {
   }
 
   pub fn merge_options(&self, options: Option<&CompilerConfigOptions>) -> Result<Self> {
-    let mut builder = CompilerConfigBuilder::with_base(self.clone());
-    if let Some(overrides) = options {
-      builder = builder.apply_compiler_options(overrides.clone())?;
+    match options {
+      // A finished configuration already went through `build`, whose settings sanitisation is
+      // idempotent, so re-running the builder without overrides can only reproduce `self`.
+      None => Ok(self.clone()),
+      Some(overrides) => self.merged(overrides),
     }
-    builder.build()
   }
 
   pub fn from_options(options: Option<CompilerConfigOptions>) -> Result<Self> {
+    let digest = options_digest(options.as_ref());
+    if let Some(digest) = digest {
+      if let Ok(cache) = construction_cache().lock() {
+        if let Some(config) = cache.get(&digest) {
+          return Ok(config.clone());
+        }
+      }
+    }
     let mut builder = CompilerConfigBuilder::from_defaults();
     if let Some(overrides) = options {
       builder = builder.apply_compiler_options(overrides)?;
     }
-    builder.build()
+    let config = builder.build()?;
+    if let Some(digest) = digest {
+      if let Ok(mut cache) = construction_cache().lock() {
+        if cache.len() >= RESOLVED_CONFIG_CACHE_CAP {
+          cache.clear();
+        }
+        cache.insert(digest, config.clone());
+      }
+    }
+    Ok(config)
+  }
+}
+
+/// Upper bound on memoised resolved configurations. Hot loops replay a handful of frozen options
+/// objects, so the maps stay tiny in practice; the cap only guards against callers that vary their
+/// options on every call, and clearing on overflow keeps the bookkeeping trivial.
+const RESOLVED_CONFIG_CACHE_CAP: usize = 64;
+
+/// Content digest of construction or override options. `None` construction options hash to a fixed
+/// sentinel so the default configuration is memoised alongside explicit ones; a serialisation
+/// failure returns `None` and simply bypasses the cache.
+fn options_digest(options: Option<&CompilerConfigOptions>) -> Option<[u8; 32]> {
+  match options {
+    Some(options) => serde_json::to_vec(options)
+      .ok()
+      .map(|bytes| *blake3::hash(&bytes).as_bytes()),
+    None => Some(*blake3::hash(b"tevm::default-compiler-config").as_bytes()),
+  }
+}
+
+/// Process-wide memo for [`CompilerConfig::from_options`]. Resolution is a pure function of the
+/// options (version parsing, settings merging, sanitisation), so short-lived compilers constructed
+/// with identical options reuse the first resolution instead of repeating it.
+fn construction_cache() -> &'static Mutex<HashMap<[u8; 32], CompilerConfig>> {
+  static CACHE: OnceLock<Mutex<HashMap<[u8; 32], CompilerConfig>>> = OnceLock::new();
+  CACHE.get_or_init(|| Mutex::new(HashMap::new()))
+}
+
+/// Memo of configurations resolved from per-call overrides against one fixed base configuration.
+/// Clones of a compiler state share the cache through an `Arc`, so a long-lived compiler that
+/// replays the same frozen override object pays for merging and sanitisation once.
+#[derive(Default)]
+pub struct ResolvedConfigCache {
+  entries: Mutex<HashMap<[u8; 32], CompilerConfig>>,
+}
+
+impl ResolvedConfigCache {
+  /// Resolve `overrides` against `base`, reusing a previously merged configuration when an
+  /// identical override object was seen before. Lock poisoning and non-serialisable overrides
+  /// degrade to uncached resolution rather than failing the call.
+  pub fn resolve(
+    &self,
+    base: &CompilerConfig,
+    overrides: Option<&CompilerConfigOptions>,
+  ) -> Result<CompilerConfig> {
+    let Some(overrides) = overrides else {
+      return base.merge_options(None);
+    };
+    let Some(digest) = options_digest(Some(overrides)) else {
+      return base.merged(overrides);
+    };
+    if let Ok(entries) = self.entries.lock() {
+      if let Some(config) = entries.get(&digest) {
+        return Ok(config.clone());
+      }
+    }
+    let config = base.merged(overrides)?;
+    if let Ok(mut entries) = self.entries.lock() {
+      if entries.len() >= RESOLVED_CONFIG_CACHE_CAP {
+        entries.clear();
+      }
+      entries.insert(digest, config.clone());
+    }
+    Ok(config)
   }
 }
 
 /// Optional overrides for constructing a [`SolcConfig`].
-#[derive(Clone, Debug, Default)]
+#[derive(Clone, Debug, Default, serde::Serialize, serde::Deserialize)]
 pub struct SolcConfigOptions {
   /// Specific solc version to use instead of the default.
   pub version: Option<Version>,
@@ -249,7 +340,7 @@ pub struct SolcConfigOptions {
 }
 
 /// Vyper-specific overrides captured from user input.
-#[derive(Clone, Debug, Default)]
+#[derive(Clone, Debug, Default, serde::Serialize, serde::Deserialize)]
 pub struct VyperConfigOptions {
   /// Optional path to a Vyper binary. Defaults to discovering `vyper` on `PATH`.
   pub path: Option<PathBuf>,
@@ -268,7 +359,7 @@ pub struct VyperConfigOptions {
 }
 
 /// Strongly-typed Rust overrides that can be merged into a [`CompilerConfig`].
-#[derive(Clone, Debug, Default)]
+#[derive(Clone, Debug, Default, serde::Serialize, serde::Deserialize)]
 pub struct CompilerConfigOptions {
   /// Desired compiler language. When `None`, the current compiler configuration (or project
   /// metadata) decides whether we compile Solidity, Yul, or Vyper.
@@ -277,6 +368,10 @@ pub struct CompilerConfigOptions {
   pub solc: SolcConfigOptions,
   /// Vyper-specific overrides applied whenever the active language front-end is `Vyper`.
   pub vyper: VyperConfigOptions,
+  /// Restricts solc to the named output sections (`abi`, `bytecode`, `ast`, …), replacing the
+  /// merged output selection with the minimal equivalent. Sections left unrequested are neither
+  /// generated by solc nor present on the resulting `CompileOutput`.
+  pub outputs: Option<Vec<String>>,
   /// Overrides the cache flag. Set to `false` to avoid writing virtual sources to
   /// `~/.tevm/virtual-sources` during inline compilations.
   pub cache_enabled: Option<bool>,
@@ -292,6 +387,12 @@ pub struct CompilerConfigOptions {
   /// Explicit solc job count override. Use `Some(Some(n))` to pin the concurrency level or
   /// `Some(None)` to reset back to auto-detection.
   pub solc_jobs: Option<Option<usize>>,
+  /// Solc pool size override. Use `Some(Some(n))` to cap concurrent solc processes for inline and
+  /// AST compilations or `Some(None)` to fall back to the pool default.
+  pub solc_pool_size: Option<Option<usize>>,
+  /// Parallel shard override. Use `Some(Some(n))` to cap the number of independent compilation
+  /// units compiled concurrently or `Some(None)` to derive the bound from the CPU count.
+  pub max_parallel_jobs: Option<Option<usize>>,
   /// Requests sparse artifact output (lighter JSON artifacts) when set to `true`.
   pub sparse_output: Option<bool>,
   /// Additional paths forwarded to solc's `--allow-paths`. Entries are canonicalised before use.
@@ -426,6 +527,7 @@ impl TryFrom<&JsCompilerConfigOptions> for CompilerConfigOptions {
       overrides.solc.settings = Some(CompilerSettingsOptions::try_from(settings)?);
     }
 
+    overrides.outputs = options.outputs.clone();
     overrides.cache_enabled = options.cache_enabled;
     overrides.offline_mode = options.offline_mode;
     overrides.no_artifacts = options.no_artifacts;
@@ -434,6 +536,10 @@ impl TryFrom<&JsCompilerConfigOptions> for CompilerConfigOptions {
     overrides.solc_jobs = options
       .solc_jobs
       .map(|jobs| if jobs == 0 { None } else { Some(jobs as usize) });
+    overrides.solc_pool_size =
+      options
+        .solc_pool_size
+        .map(|size| if size == 0 { None } else { Some(size as usize) });
     overrides.sparse_output = options.sparse_output;
     overrides.allow_paths = options
       .allow_paths
@@ -581,6 +687,13 @@ pub struct JsCompilerConfigOptions {
   /// Nested Vyper-specific configuration. Falls back to environment defaults when omitted.
   #[napi(ts_type = "VyperCompilerConfig | undefined")]
   pub vyper_settings: Option<JsVyperCompilerConfig>,
+  /// Fast mode: restricts solc to the listed output sections, skipping generation of everything
+  /// else (metadata, gas estimates, ASTs, …). The resulting `CompileOutput` omits unrequested
+  /// sections entirely. Use `solcSettings.outputSelection` instead for selections beyond this list.
+  #[napi(
+    ts_type = "Array<'abi' | 'bytecode' | 'deployedBytecode' | 'metadata' | 'storageLayout' | 'methodIdentifiers' | 'gasEstimates' | 'ast'> | undefined"
+  )]
+  pub outputs: Option<Vec<String>>,
   /// Enables the synthetic workspace cache used for inline sources. When `true` (default) we cache
   /// sources under `~/.tevm/virtual-sources`; `false` keeps everything in-memory for ephemeral runs.
   #[napi(ts_type = "boolean | undefined")]
@@ -603,6 +716,14 @@ pub struct JsCompilerConfigOptions {
   /// deterministic concurrency level inside CI.
   #[napi(ts_type = "number | undefined")]
   pub solc_jobs: Option<u32>,
+  /// Maximum number of solc processes kept busy by the warm handle pool during inline and AST
+  /// compilation. Defaults to one per logical CPU; pass `0` to reset back to that default.
+  #[napi(ts_type = "number | undefined")]
+  pub solc_pool_size: Option<u32>,
+  /// Upper bound on independent compilation shards compiled in parallel. Defaults to the logical
+  /// CPU count; pass `0` to reset back to that default.
+  #[napi(ts_type = "number | undefined")]
+  pub max_parallel_jobs: Option<u32>,
   /// Emits minimal artifact output when `true` (Foundry's sparse output mode). Defaults to `false`.
   #[napi(ts_type = "boolean | undefined")]
   pub sparse_output: Option<bool>,
@@ -1120,12 +1241,15 @@ impl CompilerConfigBuilder {
       compiler,
       mut solc,
       mut vyper,
+      outputs,
       cache_enabled,
       offline_mode,
       no_artifacts,
       build_info_enabled,
       slash_paths,
       solc_jobs,
+      solc_pool_size,
+      max_parallel_jobs,
       sparse_output,
       allow_paths,
       include_paths,
@@ -1150,6 +1274,10 @@ impl CompilerConfigBuilder {
     } else if let Some(settings) = solc.settings.take() {
       self.config.solc_settings = merge_settings(&self.config.solc_settings, Some(&settings))?;
     }
+    // Applied after the settings merge so the fast mode wins over any broader selection.
+    if let Some(outputs) = outputs {
+      self.config.solc_settings.output_selection = minimal_output_selection(&outputs)?;
+    }
     if let Some(path) = vyper.path.take() {
       self.config.vyper_settings.path = Some(path);
     }
@@ -1189,6 +1317,12 @@ impl CompilerConfigBuilder {
     if let Some(solc_jobs) = solc_jobs {
       self.config.solc_jobs = solc_jobs;
     }
+    if let Some(solc_pool_size) = solc_pool_size {
+      self.config.solc_pool_size = solc_pool_size;
+    }
+    if let Some(max_parallel_jobs) = max_parallel_jobs {
+      self.config.max_parallel_jobs = max_parallel_jobs;
+    }
     if let Some(sparse_output) = sparse_output {
       self.config.sparse_output = sparse_output;
     }
@@ -1234,6 +1368,24 @@ mod tests {
   use std::collections::BTreeMap;
   use std::path::PathBuf;
 
+  #[test]
+  fn outputs_fast_mode_replaces_merged_selection_with_the_minimal_one() {
+    let mut options = CompilerConfigOptions::default();
+    options.outputs = Some(vec!["bytecode".to_string()]);
+    let config = CompilerConfig::from_options(Some(options)).expect("config");
+
+    let selection = config.solc_settings.output_selection.as_ref();
+    let files = selection.get("*").expect("file entry");
+    assert_eq!(
+      files.get("*").expect("contract outputs"),
+      &vec!["evm.bytecode".to_string()]
+    );
+    assert!(
+      files.get("").is_none(),
+      "fast mode should not request file-level ast unless asked"
+    );
+  }
+
   #[test]
   fn compiler_settings_options_accepts_camel_case_fields() {
     let value = json!({
@@ -1356,4 +1508,65 @@ mod tests {
       .to_string()
       .contains("Unsupported compiler severity filter"));
   }
+
+  #[test]
+  fn options_digest_is_stable_and_distinguishes_options() {
+    let mut options = CompilerConfigOptions::default();
+    options.outputs = Some(vec!["abi".to_string()]);
+    let first = options_digest(Some(&options)).expect("digest");
+    let second = options_digest(Some(&options)).expect("digest");
+    assert_eq!(first, second);
+
+    options.outputs = Some(vec!["bytecode".to_string()]);
+    let changed = options_digest(Some(&options)).expect("digest");
+    assert_ne!(first, changed);
+    assert_ne!(first, options_digest(None).expect("default digest"));
+  }
+
+  #[test]
+  fn from_options_memoizes_equivalent_constructions() {
+    let mut options = CompilerConfigOptions::default();
+    options.outputs = Some(vec!["abi".to_string()]);
+    let first = CompilerConfig::from_options(Some(options.clone())).expect("config");
+    let second = CompilerConfig::from_options(Some(options)).expect("config");
+    assert_eq!(first.language, second.language);
+    assert_eq!(first.solc_version, second.solc_version);
+    assert_eq!(
+      serde_json::to_value(&first.solc_settings).expect("settings"),
+      serde_json::to_value(&second.solc_settings).expect("settings"),
+    );
+  }
+
+  #[test]
+  fn merge_options_without_overrides_returns_the_base_unchanged() {
+    let base = CompilerConfig::from_options(None).expect("config");
+    let merged = base.merge_options(None).expect("merged");
+    assert_eq!(
+      serde_json::to_value(&base.solc_settings).expect("settings"),
+      serde_json::to_value(&merged.solc_settings).expect("settings"),
+    );
+  }
+
+  #[test]
+  fn resolved_config_cache_replays_identical_overrides() {
+    let cache = ResolvedConfigCache::default();
+    let base = CompilerConfig::from_options(None).expect("config");
+    let mut overrides = CompilerConfigOptions::default();
+    overrides.outputs = Some(vec!["bytecode".to_string()]);
+
+    let first = cache.resolve(&base, Some(&overrides)).expect("resolved");
+    let second = cache.resolve(&base, Some(&overrides)).expect("resolved");
+    for config in [&first, &second] {
+      let selection = config.solc_settings.output_selection.as_ref();
+      let files = selection.get("*").expect("file entry");
+      assert_eq!(
+        files.get("*").expect("contract outputs"),
+        &vec!["evm.bytecode".to_string()]
+      );
+    }
+
+    let untouched = cache.resolve(&base, None).expect("resolved");
+    assert_eq!(untouched.language, base.language);
+    assert_eq!(untouched.solc_version, base.solc_version);
+  }
 }
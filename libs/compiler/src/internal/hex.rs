@@ -0,0 +1,258 @@
+//! Vectorized hex encode/decode for bytecode payloads.
+//!
+//! Artifact ingestion decodes every contract's creation and runtime bytecode and `to_hex` re-encodes
+//! them when surfacing bytecode to JS, so on large projects these loops dominate artifact handling.
+//! The hot paths use AVX2 on x86-64 (runtime-detected) and NEON on aarch64, with the scalar `hex`
+//! crate as the fallback for other targets — notably the WASI build, where no SIMD path is compiled
+//! in. Error reporting is delegated to the scalar path so positions and messages stay identical to
+//! the `hex` crate's.
+
+const HEX_CHARS: &[u8; 16] = b"0123456789abcdef";
+
+/// Decodes a hex string (without `0x` prefix) into bytes. Matches `hex::decode` exactly, including
+/// its error values for odd-length input and invalid characters.
+pub fn decode(input: &str) -> Result<Vec<u8>, hex::FromHexError> {
+  let bytes = input.as_bytes();
+  if bytes.len() % 2 != 0 {
+    return Err(hex::FromHexError::OddLength);
+  }
+
+  #[cfg(target_arch = "x86_64")]
+  if std::arch::is_x86_feature_detected!("avx2") {
+    // SAFETY: AVX2 support was just verified at runtime.
+    if let Some(decoded) = unsafe { avx2::decode(bytes) } {
+      return Ok(decoded);
+    }
+    // Invalid character somewhere: rerun the scalar decoder for its precise error position.
+    return hex::decode(bytes);
+  }
+
+  #[cfg(target_arch = "aarch64")]
+  {
+    if let Some(decoded) = neon::decode(bytes) {
+      return Ok(decoded);
+    }
+    return hex::decode(bytes);
+  }
+
+  #[allow(unreachable_code)]
+  hex::decode(bytes)
+}
+
+/// Encodes bytes as lowercase hex without a `0x` prefix, byte-for-byte equal to `hex::encode`.
+pub fn encode(bytes: &[u8]) -> String {
+  #[cfg(target_arch = "x86_64")]
+  if std::arch::is_x86_feature_detected!("avx2") {
+    // SAFETY: AVX2 support was just verified at runtime.
+    return unsafe { avx2::encode(bytes) };
+  }
+
+  #[cfg(target_arch = "aarch64")]
+  return neon::encode(bytes);
+
+  #[allow(unreachable_code)]
+  hex::encode(bytes)
+}
+
+/// Scalar tail used by the SIMD paths for the final sub-block chars. Returns `None` on any invalid
+/// character so the caller can fall back to the scalar decoder for error reporting.
+fn decode_tail(chars: &[u8], out: &mut Vec<u8>) -> Option<()> {
+  fn nibble(c: u8) -> Option<u8> {
+    match c {
+      b'0'..=b'9' => Some(c - b'0'),
+      b'a'..=b'f' => Some(c - b'a' + 10),
+      b'A'..=b'F' => Some(c - b'A' + 10),
+      _ => None,
+    }
+  }
+  for pair in chars.chunks_exact(2) {
+    out.push((nibble(pair[0])? << 4) | nibble(pair[1])?);
+  }
+  Some(())
+}
+
+fn encode_tail(bytes: &[u8], out: &mut Vec<u8>) {
+  for &byte in bytes {
+    out.push(HEX_CHARS[(byte >> 4) as usize]);
+    out.push(HEX_CHARS[(byte & 0x0f) as usize]);
+  }
+}
+
+#[cfg(target_arch = "x86_64")]
+mod avx2 {
+  use std::arch::x86_64::*;
+
+  /// Decodes 32 hex chars to 16 bytes per iteration. Returns `None` when any character is not a
+  /// hex digit; even-length input is the caller's responsibility.
+  #[target_feature(enable = "avx2")]
+  pub unsafe fn decode(input: &[u8]) -> Option<Vec<u8>> {
+    let mut out = Vec::with_capacity(input.len() / 2);
+    let mut chunks = input.chunks_exact(32);
+    for chunk in &mut chunks {
+      let ascii = _mm256_loadu_si256(chunk.as_ptr() as *const __m256i);
+
+      let digit = _mm256_sub_epi8(ascii, _mm256_set1_epi8(b'0' as i8));
+      let is_digit = _mm256_and_si256(
+        _mm256_cmpgt_epi8(digit, _mm256_set1_epi8(-1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(10), digit),
+      );
+      let alpha = _mm256_sub_epi8(
+        _mm256_or_si256(ascii, _mm256_set1_epi8(0x20)),
+        _mm256_set1_epi8(b'a' as i8),
+      );
+      let is_alpha = _mm256_and_si256(
+        _mm256_cmpgt_epi8(alpha, _mm256_set1_epi8(-1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(6), alpha),
+      );
+      if _mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha)) != -1 {
+        return None;
+      }
+      let value = _mm256_blendv_epi8(
+        _mm256_add_epi8(alpha, _mm256_set1_epi8(10)),
+        digit,
+        is_digit,
+      );
+
+      // Fold nibble pairs into bytes: the first char of each pair is the high nibble, so the
+      // per-pair multipliers are (16, 1).
+      let folded = _mm256_maddubs_epi16(value, _mm256_set1_epi16(0x0110));
+      let packed = _mm256_packus_epi16(folded, folded);
+      let ordered = _mm256_permute4x64_epi64(packed, 0b11_01_10_00);
+      let mut block = [0u8; 16];
+      _mm_storeu_si128(
+        block.as_mut_ptr() as *mut __m128i,
+        _mm256_castsi256_si128(ordered),
+      );
+      out.extend_from_slice(&block);
+    }
+    super::decode_tail(chunks.remainder(), &mut out)?;
+    Some(out)
+  }
+
+  /// Encodes 32 bytes to 64 lowercase hex chars per iteration via a nibble table lookup.
+  #[target_feature(enable = "avx2")]
+  pub unsafe fn encode(input: &[u8]) -> String {
+    let mut out = Vec::with_capacity(input.len() * 2);
+    let table =
+      _mm256_broadcastsi128_si256(_mm_loadu_si128(super::HEX_CHARS.as_ptr() as *const __m128i));
+    let mut chunks = input.chunks_exact(32);
+    for chunk in &mut chunks {
+      let src = _mm256_loadu_si256(chunk.as_ptr() as *const __m256i);
+      let hi = _mm256_and_si256(_mm256_srli_epi16(src, 4), _mm256_set1_epi8(0x0f));
+      let lo = _mm256_and_si256(src, _mm256_set1_epi8(0x0f));
+      let first = _mm256_shuffle_epi8(table, _mm256_unpacklo_epi8(hi, lo));
+      let second = _mm256_shuffle_epi8(table, _mm256_unpackhi_epi8(hi, lo));
+
+      // Unpack interleaves within 128-bit lanes; permute restores contiguous output order.
+      let mut block = [0u8; 64];
+      _mm256_storeu_si256(
+        block.as_mut_ptr() as *mut __m256i,
+        _mm256_permute2x128_si256(first, second, 0x20),
+      );
+      _mm256_storeu_si256(
+        block.as_mut_ptr().add(32) as *mut __m256i,
+        _mm256_permute2x128_si256(first, second, 0x31),
+      );
+      out.extend_from_slice(&block);
+    }
+    super::encode_tail(chunks.remainder(), &mut out);
+    // SAFETY: the table lookup only ever emits ASCII hex characters.
+    unsafe { String::from_utf8_unchecked(out) }
+  }
+}
+
+#[cfg(target_arch = "aarch64")]
+mod neon {
+  use std::arch::aarch64::*;
+
+  /// Decodes 16 hex chars to 8 bytes per iteration. Returns `None` when any character is not a
+  /// hex digit; even-length input is the caller's responsibility.
+  pub fn decode(input: &[u8]) -> Option<Vec<u8>> {
+    let mut out = Vec::with_capacity(input.len() / 2);
+    let mut chunks = input.chunks_exact(16);
+    for chunk in &mut chunks {
+      // SAFETY: NEON is baseline on aarch64 and the chunk is exactly 16 bytes.
+      unsafe {
+        let ascii = vld1q_u8(chunk.as_ptr());
+        let digit = vsubq_u8(ascii, vdupq_n_u8(b'0'));
+        let is_digit = vcltq_u8(digit, vdupq_n_u8(10));
+        let alpha = vsubq_u8(vorrq_u8(ascii, vdupq_n_u8(0x20)), vdupq_n_u8(b'a'));
+        let is_alpha = vcltq_u8(alpha, vdupq_n_u8(6));
+        if vminvq_u8(vorrq_u8(is_digit, is_alpha)) != 0xff {
+          return None;
+        }
+        let value = vbslq_u8(is_digit, digit, vaddq_u8(alpha, vdupq_n_u8(10)));
+
+        // Even positions hold high nibbles, odd positions low nibbles.
+        let hi = vuzp1q_u8(value, value);
+        let lo = vuzp2q_u8(value, value);
+        let bytes = vorrq_u8(vshlq_n_u8::<4>(hi), lo);
+        let mut block = [0u8; 8];
+        vst1_u8(block.as_mut_ptr(), vget_low_u8(bytes));
+        out.extend_from_slice(&block);
+      }
+    }
+    super::decode_tail(chunks.remainder(), &mut out)?;
+    Some(out)
+  }
+
+  /// Encodes 16 bytes to 32 lowercase hex chars per iteration via `vqtbl1q` nibble lookups.
+  pub fn encode(input: &[u8]) -> String {
+    let mut out = Vec::with_capacity(input.len() * 2);
+    let mut chunks = input.chunks_exact(16);
+    for chunk in &mut chunks {
+      // SAFETY: NEON is baseline on aarch64 and the chunk is exactly 16 bytes.
+      unsafe {
+        let table = vld1q_u8(super::HEX_CHARS.as_ptr());
+        let src = vld1q_u8(chunk.as_ptr());
+        let hi = vqtbl1q_u8(table, vshrq_n_u8::<4>(src));
+        let lo = vqtbl1q_u8(table, vandq_u8(src, vdupq_n_u8(0x0f)));
+        let mut block = [0u8; 32];
+        // `vst2` interleaves the registers, yielding high/low chars in output order.
+        vst2q_u8(block.as_mut_ptr(), uint8x16x2_t(hi, lo));
+        out.extend_from_slice(&block);
+      }
+    }
+    super::encode_tail(chunks.remainder(), &mut out);
+    // SAFETY: the table lookup only ever emits ASCII hex characters.
+    unsafe { String::from_utf8_unchecked(out) }
+  }
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+
+  fn sample(len: usize) -> Vec<u8> {
+    (0..len).map(|index| (index * 37 % 256) as u8).collect()
+  }
+
+  #[test]
+  fn encode_matches_the_scalar_crate_across_block_boundaries() {
+    for len in [0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1024] {
+      let bytes = sample(len);
+      assert_eq!(encode(&bytes), hex::encode(&bytes), "length {len}");
+    }
+  }
+
+  #[test]
+  fn decode_round_trips_and_accepts_mixed_case() {
+    for len in [0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1024] {
+      let bytes = sample(len);
+      assert_eq!(decode(&hex::encode(&bytes)).unwrap(), bytes, "length {len}");
+      assert_eq!(
+        decode(&hex::encode_upper(&bytes)).unwrap(),
+        bytes,
+        "length {len} upper"
+      );
+    }
+  }
+
+  #[test]
+  fn decode_errors_match_the_scalar_crate() {
+    assert_eq!(decode("abc"), Err(hex::FromHexError::OddLength));
+    let mut invalid = hex::encode(sample(64));
+    invalid.replace_range(40..41, "g");
+    assert_eq!(decode(&invalid), hex::decode(&invalid));
+  }
+}
@@ -0,0 +1,52 @@
+use std::collections::HashSet;
+use std::sync::Arc;
+
+/// Deduplicates the strings materialised while assembling a [`CompileOutput`]
+/// (`crate::compiler::output::CompileOutput`). Source paths and contract names repeat across
+/// artifact keys, per-contract states, and diagnostic locations; interning hands every repeat the
+/// same `Arc<str>` so a full-project output stores each long absolute path once. The interner is
+/// scoped to one output build and dropped with it — nothing is retained process-wide.
+#[derive(Debug, Default)]
+pub(crate) struct StringInterner {
+  entries: HashSet<Arc<str>>,
+}
+
+impl StringInterner {
+  pub(crate) fn new() -> Self {
+    Self::default()
+  }
+
+  /// Return the shared allocation for `value`, inserting it on first sight.
+  pub(crate) fn intern(&mut self, value: &str) -> Arc<str> {
+    if let Some(existing) = self.entries.get(value) {
+      return Arc::clone(existing);
+    }
+    let entry: Arc<str> = Arc::from(value);
+    self.entries.insert(Arc::clone(&entry));
+    entry
+  }
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+
+  #[test]
+  fn repeated_strings_share_one_allocation() {
+    let mut interner = StringInterner::new();
+    let first = interner.intern("/project/src/Counter.sol");
+    let second = interner.intern("/project/src/Counter.sol");
+    assert!(Arc::ptr_eq(&first, &second));
+    assert_eq!(interner.entries.len(), 1);
+  }
+
+  #[test]
+  fn distinct_strings_stay_distinct() {
+    let mut interner = StringInterner::new();
+    let a = interner.intern("A.sol");
+    let b = interner.intern("B.sol");
+    assert!(!Arc::ptr_eq(&a, &b));
+    assert_eq!(&*a, "A.sol");
+    assert_eq!(&*b, "B.sol");
+  }
+}
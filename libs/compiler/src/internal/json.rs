@@ -0,0 +1,53 @@
+//! Typed parsing of solc's standard-JSON output.
+//!
+//! A project compile's stdout can run to tens of megabytes, and parsing it can rival the solc run
+//! itself. On x86-64 and aarch64 the bytes are deserialized straight into the typed output structs
+//! with simd-json's tape parser — no intermediate `serde_json::Value` tree; other targets (the
+//! WASI build) fall back to serde_json, which is the only scalar path available there.
+
+use serde::de::DeserializeOwned;
+
+use crate::internal::errors::{Error, Result};
+use crate::internal::metrics;
+
+/// Parses solc stdout into `T`, consuming the buffer (simd-json unescapes strings in place).
+/// `context` prefixes any parse error, matching the `map_err_with_context` convention used at the
+/// call sites this replaces.
+#[allow(unused_mut)]
+pub(crate) fn from_solc_stdout<T: DeserializeOwned>(
+  mut bytes: Vec<u8>,
+  context: &str,
+) -> Result<T> {
+  let _span = metrics::span(metrics::Phase::JsonParse);
+
+  #[cfg(any(target_arch = "x86_64", target_arch = "aarch64"))]
+  {
+    simd_json::serde::from_slice(&mut bytes).map_err(|err| Error::with_context(context, err))
+  }
+
+  #[cfg(not(any(target_arch = "x86_64", target_arch = "aarch64")))]
+  {
+    crate::internal::errors::map_err_with_context(serde_json::from_slice(&bytes), context)
+  }
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+
+  #[test]
+  fn parses_typed_output_and_reports_errors_with_context() {
+    #[derive(Debug, serde::Deserialize)]
+    struct Probe {
+      version: String,
+    }
+
+    let parsed: Probe =
+      from_solc_stdout(br#"{"version":"0.8.30"}"#.to_vec(), "Failed to parse").expect("parses");
+    assert_eq!(parsed.version, "0.8.30");
+
+    let error = from_solc_stdout::<Probe>(b"{not json".to_vec(), "Failed to parse solc output")
+      .expect_err("invalid JSON errors");
+    assert!(error.message().starts_with("Failed to parse solc output"));
+  }
+}
@@ -1,5 +1,6 @@
+use std::cell::UnsafeCell;
 use std::fmt::Write as _;
-use std::sync::atomic::{AtomicU8, Ordering};
+use std::sync::atomic::{AtomicBool, AtomicU8, AtomicUsize, Ordering};
 use std::sync::{Arc, RwLock};
 
 use log::{Level, LevelFilter, Log, Metadata, Record};
@@ -13,7 +14,7 @@ use once_cell::sync::OnceCell;
 use crate::internal::errors::Result;
 
 /// Shared logging level exposed to both Rust and JavaScript callers.
-#[derive(Clone, Copy, Debug, Eq, PartialEq, Default)]
+#[derive(Clone, Copy, Debug, Eq, PartialEq, Default, serde::Serialize, serde::Deserialize)]
 pub enum LoggingLevel {
   #[default]
   Silent,
@@ -89,8 +90,9 @@ pub fn ensure_napi_logger(_: &Env, _: LoggingLevel) -> napi::Result<()> {
 #[cfg(not(test))]
 pub fn ensure_napi_logger(env: &Env, level: LoggingLevel) -> napi::Result<()> {
   let state = install_logger().map_err(napi::Error::from)?;
-  let tsfn = create_threadsafe_logger(env)?;
-  state.set_node_backend(tsfn);
+  let channel = Arc::new(LogChannel::new());
+  let wake = create_drain_function(env, channel.clone())?;
+  state.set_node_backend(NodeBackend { channel, wake });
   state.update_level(level);
   Ok(())
 }
@@ -104,17 +106,155 @@ pub fn update_level(level: LoggingLevel) {
   }
 }
 
-#[cfg(not(test))]
 #[derive(Clone)]
 struct LogInvocation {
   level: LoggingLevel,
   line: String,
 }
 
+/// Records buffered between a producer thread and the JS drain. Sized so a burst of per-node
+/// stitcher diagnostics fits without overflowing; beyond that, records are dropped and counted
+/// rather than ever blocking the compile path.
+const LOG_RING_CAPACITY: usize = 1024;
+
+/// Slot of the bounded MPMC ring below. The sequence number encodes whether the slot is free for
+/// the producer at a given ticket (`seq == ticket`) or holds a record for the consumer
+/// (`seq == ticket + 1`); see Vyukov's bounded queue for the protocol.
+struct LogSlot {
+  sequence: AtomicUsize,
+  record: UnsafeCell<Option<LogInvocation>>,
+}
+
+/// Bounded lock-free ring buffer carrying log records from arbitrary Rust threads to the single
+/// JS drain. `push` performs no syscalls and no JS hops — just a CAS on the tail plus a slot
+/// write — so hot loops can log at debug level without serialising on the N-API boundary. A full
+/// ring drops the record and increments a counter that the next drain surfaces.
+struct LogRing {
+  slots: Box<[LogSlot]>,
+  head: AtomicUsize,
+  tail: AtomicUsize,
+  dropped: AtomicUsize,
+}
+
+// SAFETY: slot contents are only touched by the thread that won the corresponding sequence
+// ticket, which the acquire/release protocol on `sequence` makes exclusive.
+unsafe impl Send for LogRing {}
+unsafe impl Sync for LogRing {}
+
+impl LogRing {
+  fn with_capacity(capacity: usize) -> Self {
+    debug_assert!(capacity.is_power_of_two());
+    let slots = (0..capacity)
+      .map(|index| LogSlot {
+        sequence: AtomicUsize::new(index),
+        record: UnsafeCell::new(None),
+      })
+      .collect::<Vec<_>>()
+      .into_boxed_slice();
+    Self {
+      slots,
+      head: AtomicUsize::new(0),
+      tail: AtomicUsize::new(0),
+      dropped: AtomicUsize::new(0),
+    }
+  }
+
+  fn mask(&self) -> usize {
+    self.slots.len() - 1
+  }
+
+  /// Push a record, returning `false` (and counting the drop) when the ring is full.
+  fn push(&self, record: LogInvocation) -> bool {
+    let mut tail = self.tail.load(Ordering::Relaxed);
+    loop {
+      let slot = &self.slots[tail & self.mask()];
+      let sequence = slot.sequence.load(Ordering::Acquire);
+      let lag = sequence as isize - tail as isize;
+      if lag == 0 {
+        match self
+          .tail
+          .compare_exchange_weak(tail, tail + 1, Ordering::Relaxed, Ordering::Relaxed)
+        {
+          Ok(_) => {
+            // SAFETY: winning the CAS for `tail` grants exclusive access to this slot until the
+            // sequence below is published.
+            unsafe { *slot.record.get() = Some(record) };
+            slot.sequence.store(tail + 1, Ordering::Release);
+            return true;
+          }
+          Err(current) => tail = current,
+        }
+      } else if lag < 0 {
+        self.dropped.fetch_add(1, Ordering::Relaxed);
+        return false;
+      } else {
+        tail = self.tail.load(Ordering::Relaxed);
+      }
+    }
+  }
+
+  fn pop(&self) -> Option<LogInvocation> {
+    let mut head = self.head.load(Ordering::Relaxed);
+    loop {
+      let slot = &self.slots[head & self.mask()];
+      let sequence = slot.sequence.load(Ordering::Acquire);
+      let lag = sequence as isize - (head + 1) as isize;
+      if lag == 0 {
+        match self
+          .head
+          .compare_exchange_weak(head, head + 1, Ordering::Relaxed, Ordering::Relaxed)
+        {
+          Ok(_) => {
+            // SAFETY: winning the CAS for `head` grants exclusive access to this slot until the
+            // sequence below recycles it.
+            let record = unsafe { (*slot.record.get()).take() };
+            slot
+              .sequence
+              .store(head + self.slots.len(), Ordering::Release);
+            return record;
+          }
+          Err(current) => head = current,
+        }
+      } else if lag < 0 {
+        return None;
+      } else {
+        head = self.head.load(Ordering::Relaxed);
+      }
+    }
+  }
+
+  /// Number of records dropped since the previous call, resetting the counter.
+  fn take_dropped(&self) -> usize {
+    self.dropped.swap(0, Ordering::Relaxed)
+  }
+}
+
+/// Shared state between log producers and the JS drain: the ring itself plus a flag that
+/// coalesces wake-ups so a burst of records costs a single threadsafe-function call.
+struct LogChannel {
+  ring: LogRing,
+  drain_pending: AtomicBool,
+}
+
+impl LogChannel {
+  fn new() -> Self {
+    Self {
+      ring: LogRing::with_capacity(LOG_RING_CAPACITY),
+      drain_pending: AtomicBool::new(false),
+    }
+  }
+}
+
+#[cfg(not(test))]
+struct NodeBackend {
+  channel: Arc<LogChannel>,
+  wake: ThreadsafeFunction<()>,
+}
+
 enum LoggerBackend {
   Stdout,
   #[cfg(not(test))]
-  Node(ThreadsafeFunction<LogInvocation>),
+  Node(NodeBackend),
 }
 
 struct LoggerState {
@@ -138,9 +278,9 @@ impl LoggerState {
   }
 
   #[cfg(not(test))]
-  fn set_node_backend(&self, tsfn: ThreadsafeFunction<LogInvocation>) {
+  fn set_node_backend(&self, node: NodeBackend) {
     let mut backend = self.backend.write().expect("logger backend lock poisoned");
-    *backend = Some(LoggerBackend::Node(tsfn));
+    *backend = Some(LoggerBackend::Node(node));
   }
 
   fn update_level(&self, level: LoggingLevel) {
@@ -196,14 +336,15 @@ impl Log for ConsoleLogger {
     match backend_guard.as_ref() {
       Some(LoggerBackend::Stdout) => dispatch_stdout(level, &line),
       #[cfg(not(test))]
-      Some(LoggerBackend::Node(tsfn)) => {
-        let _ = tsfn.call(
-          Ok(LogInvocation {
-            level,
-            line: line.clone(),
-          }),
-          ThreadsafeFunctionCallMode::NonBlocking,
-        );
+      Some(LoggerBackend::Node(node)) => {
+        node.channel.ring.push(LogInvocation { level, line });
+        // One wake per burst: the first producer after a drain schedules the flush, everyone else
+        // just enqueues. A dropped record still reaches this point so its count gets surfaced.
+        if !node.channel.drain_pending.swap(true, Ordering::AcqRel) {
+          let _ = node
+            .wake
+            .call(Ok(()), ThreadsafeFunctionCallMode::NonBlocking);
+        }
       }
       None => dispatch_stdout(level, &line),
     }
@@ -230,22 +371,43 @@ fn install_logger() -> Result<Arc<LoggerState>> {
   Ok(state)
 }
 
+/// Build the drain task: one threadsafe-function call flushes every buffered record to the
+/// console in a single JS hop, then reports how many records overflowed since the last flush.
 #[cfg(not(test))]
-fn create_threadsafe_logger(env: &Env) -> napi::Result<ThreadsafeFunction<LogInvocation>> {
+fn create_drain_function(
+  env: &Env,
+  channel: Arc<LogChannel>,
+) -> napi::Result<ThreadsafeFunction<()>> {
   let console: JsObject = env.get_global()?.get_named_property("console")?;
   let log_fn: JsFunction = console.get_named_property("log")?;
-  env.create_threadsafe_function::<LogInvocation, JsUnknown, _>(&log_fn, 0, |ctx| {
+  env.create_threadsafe_function::<(), JsUnknown, _>(&log_fn, 0, move |ctx| {
+    // Clear the flag before draining so a record pushed mid-flush schedules the next wake.
+    channel.drain_pending.store(false, Ordering::Release);
+
     let console: JsObject = ctx.env.get_global()?.get_named_property("console")?;
-    let method = match ctx.value.level {
-      LoggingLevel::Error => "error",
-      LoggingLevel::Warn => "warn",
-      LoggingLevel::Silent | LoggingLevel::Info => "log",
-    };
-    let js_fn: JsFunction = console
-      .get_named_property(method)
-      .or_else(|_| console.get_named_property("log"))?;
-    let message = ctx.env.create_string(&ctx.value.line)?;
-    js_fn.call(Some(&console), &[message.into_unknown()])?;
+    while let Some(record) = channel.ring.pop() {
+      let method = match record.level {
+        LoggingLevel::Error => "error",
+        LoggingLevel::Warn => "warn",
+        LoggingLevel::Silent | LoggingLevel::Info => "log",
+      };
+      let js_fn: JsFunction = console
+        .get_named_property(method)
+        .or_else(|_| console.get_named_property("log"))?;
+      let message = ctx.env.create_string(&record.line)?;
+      js_fn.call(Some(&console), &[message.into_unknown()])?;
+    }
+
+    let dropped = channel.ring.take_dropped();
+    if dropped > 0 {
+      let warn_fn: JsFunction = console
+        .get_named_property("warn")
+        .or_else(|_| console.get_named_property("log"))?;
+      let message = ctx.env.create_string(&format!(
+        "[WARN] tevm::logging - dropped {dropped} log record(s): ring buffer overflowed"
+      ))?;
+      warn_fn.call(Some(&console), &[message.into_unknown()])?;
+    }
     Ok(Vec::new())
   })
 }
@@ -283,4 +445,63 @@ mod tests {
     ensure_rust_logger(LoggingLevel::Warn).expect("update logger level");
     assert_eq!(log::max_level(), LevelFilter::Warn);
   }
+
+  fn record(line: &str) -> LogInvocation {
+    LogInvocation {
+      level: LoggingLevel::Info,
+      line: line.to_string(),
+    }
+  }
+
+  #[test]
+  fn ring_preserves_record_order() {
+    let ring = LogRing::with_capacity(8);
+    for index in 0..5 {
+      assert!(ring.push(record(&format!("line {index}"))));
+    }
+    for index in 0..5 {
+      assert_eq!(ring.pop().expect("record").line, format!("line {index}"));
+    }
+    assert!(ring.pop().is_none());
+  }
+
+  #[test]
+  fn full_ring_drops_records_and_counts_them() {
+    let ring = LogRing::with_capacity(4);
+    for index in 0..6 {
+      ring.push(record(&format!("line {index}")));
+    }
+    assert_eq!(ring.take_dropped(), 2);
+    assert_eq!(ring.take_dropped(), 0, "counter resets after being read");
+
+    // Draining frees the slots for the next burst.
+    while ring.pop().is_some() {}
+    assert!(ring.push(record("after drain")));
+    assert_eq!(ring.pop().expect("record").line, "after drain");
+  }
+
+  #[test]
+  fn concurrent_producers_never_lose_accepted_records() {
+    let ring = Arc::new(LogRing::with_capacity(1024));
+    let producers = 4;
+    let per_producer = 200;
+
+    std::thread::scope(|scope| {
+      for producer in 0..producers {
+        let ring = ring.clone();
+        scope.spawn(move || {
+          for index in 0..per_producer {
+            assert!(ring.push(record(&format!("{producer}:{index}"))));
+          }
+        });
+      }
+    });
+
+    let mut drained = 0;
+    while ring.pop().is_some() {
+      drained += 1;
+    }
+    assert_eq!(drained, producers * per_producer);
+    assert_eq!(ring.take_dropped(), 0);
+  }
 }
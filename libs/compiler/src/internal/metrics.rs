@@ -0,0 +1,223 @@
+use std::collections::HashMap;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::time::Instant;
+
+/// Pipeline phases measured by [`span`]. Each phase maps to one chokepoint in the compile path so
+/// a slow build can be attributed to project resolution, the solc subprocess, standard-JSON
+/// parsing, output conversion, or AST manipulation instead of guessed at from ad-hoc log lines.
+#[derive(Clone, Copy, Debug)]
+pub(crate) enum Phase {
+  ProjectResolution,
+  SolcExecution,
+  JsonParse,
+  OutputConversion,
+  AstOperation,
+}
+
+impl Phase {
+  const ALL: [Phase; 5] = [
+    Phase::ProjectResolution,
+    Phase::SolcExecution,
+    Phase::JsonParse,
+    Phase::OutputConversion,
+    Phase::AstOperation,
+  ];
+
+  /// Stable key used in the `phases` record returned by `Compiler.getMetrics`.
+  const fn as_str(self) -> &'static str {
+    match self {
+      Phase::ProjectResolution => "projectResolution",
+      Phase::SolcExecution => "solcExecution",
+      Phase::JsonParse => "jsonParse",
+      Phase::OutputConversion => "outputConversion",
+      Phase::AstOperation => "astOperation",
+    }
+  }
+
+  const fn index(self) -> usize {
+    match self {
+      Phase::ProjectResolution => 0,
+      Phase::SolcExecution => 1,
+      Phase::JsonParse => 2,
+      Phase::OutputConversion => 3,
+      Phase::AstOperation => 4,
+    }
+  }
+}
+
+struct PhaseCounter {
+  calls: AtomicU64,
+  nanos: AtomicU64,
+}
+
+#[allow(clippy::declare_interior_mutable_const)]
+const ZERO_COUNTER: PhaseCounter = PhaseCounter {
+  calls: AtomicU64::new(0),
+  nanos: AtomicU64::new(0),
+};
+
+/// Process-wide accumulators. A span records two relaxed atomic adds on drop, so instrumentation
+/// stays cheap enough to leave enabled unconditionally.
+static COUNTERS: [PhaseCounter; Phase::ALL.len()] = [ZERO_COUNTER; Phase::ALL.len()];
+
+static DISK_CACHE_HITS: AtomicU64 = AtomicU64::new(0);
+static DISK_CACHE_MISSES: AtomicU64 = AtomicU64::new(0);
+
+/// RAII timer for one phase execution; the elapsed time is accumulated when the guard drops, so
+/// early returns and `?` propagation are measured correctly.
+pub(crate) struct PhaseSpan {
+  phase: Phase,
+  started: Instant,
+}
+
+impl Drop for PhaseSpan {
+  fn drop(&mut self) {
+    let counter = &COUNTERS[self.phase.index()];
+    counter.calls.fetch_add(1, Ordering::Relaxed);
+    counter
+      .nanos
+      .fetch_add(self.started.elapsed().as_nanos() as u64, Ordering::Relaxed);
+  }
+}
+
+/// Start timing one execution of `phase`.
+pub(crate) fn span(phase: Phase) -> PhaseSpan {
+  PhaseSpan {
+    phase,
+    started: Instant::now(),
+  }
+}
+
+/// Record the outcome of a disk cache lookup. The in-memory cache keeps its own counters on
+/// [`CompileCache`](crate::compiler::CompileCacheStats) since they are per-instance, not global.
+pub(crate) fn record_disk_cache(hit: bool) {
+  if hit {
+    DISK_CACHE_HITS.fetch_add(1, Ordering::Relaxed);
+  } else {
+    DISK_CACHE_MISSES.fetch_add(1, Ordering::Relaxed);
+  }
+}
+
+/// Accumulated timings for one pipeline phase.
+#[napi(object, js_name = "PhaseMetrics")]
+#[derive(Clone, Copy, Debug)]
+pub struct JsPhaseMetrics {
+  /// Number of times the phase executed since process start.
+  pub calls: i64,
+  /// Total wall-clock time spent in the phase, in milliseconds.
+  pub total_ms: f64,
+  /// Mean wall-clock time per execution, in milliseconds. Zero when the phase never ran.
+  pub avg_ms: f64,
+}
+
+/// Hit/miss counters for one cache tier together with the derived hit rate.
+#[napi(object, js_name = "CacheRateMetrics")]
+#[derive(Clone, Copy, Debug)]
+pub struct JsCacheRateMetrics {
+  /// Number of lookups answered by this tier.
+  pub hits: i64,
+  /// Number of lookups that fell through to the tier below (or to a full compilation).
+  pub misses: i64,
+  /// Fraction of lookups answered by this tier, or `undefined` before the first lookup.
+  #[napi(ts_type = "number | undefined")]
+  pub hit_rate: Option<f64>,
+}
+
+impl JsCacheRateMetrics {
+  pub(crate) fn from_counts(hits: u64, misses: u64) -> Self {
+    let total = hits + misses;
+    Self {
+      hits: hits as i64,
+      misses: misses as i64,
+      hit_rate: (total > 0).then(|| hits as f64 / total as f64),
+    }
+  }
+}
+
+/// Process-wide performance snapshot returned by `Compiler.getMetrics`.
+#[napi(object, js_name = "CompilerMetrics")]
+#[derive(Clone, Debug)]
+pub struct JsCompilerMetrics {
+  /// Per-phase wall-clock accounting keyed by phase name (`solcExecution`, `jsonParse`, ...).
+  pub phases: HashMap<String, JsPhaseMetrics>,
+  /// Hit rate of the persistent binary cache tier, aggregated across compiler instances.
+  pub disk_cache: JsCacheRateMetrics,
+  /// Hit rate of this compiler's in-memory compile cache.
+  pub memory_cache: JsCacheRateMetrics,
+}
+
+/// Snapshot the global phase and disk cache counters. The caller supplies the per-instance memory
+/// cache counts since those live on the compiler state, not in process-wide statics.
+pub(crate) fn snapshot(memory_hits: u64, memory_misses: u64) -> JsCompilerMetrics {
+  let mut phases = HashMap::with_capacity(Phase::ALL.len());
+  for phase in Phase::ALL {
+    let counter = &COUNTERS[phase.index()];
+    let calls = counter.calls.load(Ordering::Relaxed);
+    let total_ms = counter.nanos.load(Ordering::Relaxed) as f64 / 1_000_000.0;
+    phases.insert(
+      phase.as_str().to_string(),
+      JsPhaseMetrics {
+        calls: calls as i64,
+        total_ms,
+        avg_ms: if calls > 0 {
+          total_ms / calls as f64
+        } else {
+          0.0
+        },
+      },
+    );
+  }
+
+  JsCompilerMetrics {
+    phases,
+    disk_cache: JsCacheRateMetrics::from_counts(
+      DISK_CACHE_HITS.load(Ordering::Relaxed),
+      DISK_CACHE_MISSES.load(Ordering::Relaxed),
+    ),
+    memory_cache: JsCacheRateMetrics::from_counts(memory_hits, memory_misses),
+  }
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+
+  #[test]
+  fn spans_accumulate_calls_and_time() {
+    let before = snapshot(0, 0);
+    let before_phase = before.phases["astOperation"];
+
+    {
+      let _span = span(Phase::AstOperation);
+      std::thread::sleep(std::time::Duration::from_millis(2));
+    }
+
+    let after = snapshot(0, 0);
+    let after_phase = after.phases["astOperation"];
+    assert_eq!(after_phase.calls, before_phase.calls + 1);
+    assert!(after_phase.total_ms > before_phase.total_ms);
+    assert!(after_phase.avg_ms > 0.0);
+  }
+
+  #[test]
+  fn cache_rates_derive_from_counts() {
+    let rate = JsCacheRateMetrics::from_counts(3, 1);
+    assert_eq!(rate.hits, 3);
+    assert_eq!(rate.misses, 1);
+    assert_eq!(rate.hit_rate, Some(0.75));
+
+    let empty = JsCacheRateMetrics::from_counts(0, 0);
+    assert_eq!(
+      empty.hit_rate, None,
+      "rate is undefined before the first lookup"
+    );
+  }
+
+  #[test]
+  fn snapshot_reports_every_phase() {
+    let metrics = snapshot(0, 0);
+    for phase in Phase::ALL {
+      assert!(metrics.phases.contains_key(phase.as_str()));
+    }
+  }
+}
@@ -1,8 +1,15 @@
 pub(crate) mod config;
 pub(crate) mod errors;
+pub(crate) mod hex;
+pub(crate) mod intern;
+pub(crate) mod json;
 pub(crate) mod logging;
+pub(crate) mod metrics;
+pub(crate) mod napi_ser;
 pub(crate) mod path;
 pub(crate) mod project;
+pub(crate) mod project_snapshot;
 pub(crate) mod settings;
 pub(crate) mod solc;
+pub(crate) mod solc_pool;
 pub(crate) mod vyper;
@@ -0,0 +1,401 @@
+use napi::{Env, JsObject, JsString, JsUnknown};
+use serde::ser::{self, Serialize, Serializer};
+
+/// Serialize `value` directly into napi values without taking ownership.
+///
+/// `Env::to_js_value` already writes JS values straight from a `Serialize` reference, but it maps
+/// `None` to `null`, whereas the `#[napi(object)]` derives omit absent optional fields entirely.
+/// The snapshot structs returned by `toJson()`/`materialize()` cross the boundary through those
+/// derives, which consume their input — so every call had to deep-clone the cached snapshot first.
+/// This serializer reproduces the derive output shape (absent `Option` fields are omitted,
+/// `serde_json::Value::Null` still becomes `null`) while reading from a reference, so cached
+/// snapshots and raw artifact trees convert without being copied.
+pub(crate) fn to_js<T>(env: &Env, value: &T) -> napi::Result<JsUnknown>
+where
+  T: Serialize + ?Sized,
+{
+  match value.serialize(NapiRefSerializer { env })? {
+    Some(unknown) => Ok(unknown),
+    None => Ok(env.get_undefined()?.into_unknown()),
+  }
+}
+
+/// Serializer writing napi values from borrowed data. `Ok` is `None` when the serialized value is
+/// an absent `Option`, letting struct and map writers skip the property instead of storing `null`.
+struct NapiRefSerializer<'env> {
+  env: &'env Env,
+}
+
+impl<'env> Serializer for NapiRefSerializer<'env> {
+  type Ok = Option<JsUnknown>;
+  type Error = napi::Error;
+
+  type SerializeSeq = SeqWriter<'env>;
+  type SerializeTuple = SeqWriter<'env>;
+  type SerializeTupleStruct = SeqWriter<'env>;
+  type SerializeTupleVariant = VariantSeqWriter<'env>;
+  type SerializeMap = MapWriter<'env>;
+  type SerializeStruct = StructWriter<'env>;
+  type SerializeStructVariant = VariantStructWriter<'env>;
+
+  fn serialize_bool(self, v: bool) -> napi::Result<Self::Ok> {
+    Ok(Some(self.env.get_boolean(v)?.into_unknown()))
+  }
+
+  fn serialize_i8(self, v: i8) -> napi::Result<Self::Ok> {
+    self.serialize_i32(v as i32)
+  }
+
+  fn serialize_i16(self, v: i16) -> napi::Result<Self::Ok> {
+    self.serialize_i32(v as i32)
+  }
+
+  fn serialize_i32(self, v: i32) -> napi::Result<Self::Ok> {
+    Ok(Some(self.env.create_int32(v)?.into_unknown()))
+  }
+
+  fn serialize_i64(self, v: i64) -> napi::Result<Self::Ok> {
+    Ok(Some(self.env.create_int64(v)?.into_unknown()))
+  }
+
+  fn serialize_u8(self, v: u8) -> napi::Result<Self::Ok> {
+    self.serialize_u32(v as u32)
+  }
+
+  fn serialize_u16(self, v: u16) -> napi::Result<Self::Ok> {
+    self.serialize_u32(v as u32)
+  }
+
+  fn serialize_u32(self, v: u32) -> napi::Result<Self::Ok> {
+    Ok(Some(self.env.create_uint32(v)?.into_unknown()))
+  }
+
+  fn serialize_u64(self, v: u64) -> napi::Result<Self::Ok> {
+    if v <= u32::MAX as u64 {
+      self.serialize_u32(v as u32)
+    } else {
+      self.serialize_i64(v as i64)
+    }
+  }
+
+  fn serialize_i128(self, v: i128) -> napi::Result<Self::Ok> {
+    self.serialize_str(&v.to_string())
+  }
+
+  fn serialize_u128(self, v: u128) -> napi::Result<Self::Ok> {
+    self.serialize_str(&v.to_string())
+  }
+
+  fn serialize_f32(self, v: f32) -> napi::Result<Self::Ok> {
+    self.serialize_f64(v as f64)
+  }
+
+  fn serialize_f64(self, v: f64) -> napi::Result<Self::Ok> {
+    Ok(Some(self.env.create_double(v)?.into_unknown()))
+  }
+
+  fn serialize_char(self, v: char) -> napi::Result<Self::Ok> {
+    self.serialize_str(v.encode_utf8(&mut [0; 4]))
+  }
+
+  fn serialize_str(self, v: &str) -> napi::Result<Self::Ok> {
+    Ok(Some(self.env.create_string(v)?.into_unknown()))
+  }
+
+  fn serialize_bytes(self, v: &[u8]) -> napi::Result<Self::Ok> {
+    Ok(Some(
+      self.env.create_buffer_with_data(v.to_vec())?.into_unknown(),
+    ))
+  }
+
+  fn serialize_none(self) -> napi::Result<Self::Ok> {
+    Ok(None)
+  }
+
+  fn serialize_some<T>(self, value: &T) -> napi::Result<Self::Ok>
+  where
+    T: Serialize + ?Sized,
+  {
+    value.serialize(self)
+  }
+
+  fn serialize_unit(self) -> napi::Result<Self::Ok> {
+    Ok(Some(self.env.get_null()?.into_unknown()))
+  }
+
+  fn serialize_unit_struct(self, _name: &'static str) -> napi::Result<Self::Ok> {
+    self.serialize_unit()
+  }
+
+  fn serialize_unit_variant(
+    self,
+    _name: &'static str,
+    _variant_index: u32,
+    variant: &'static str,
+  ) -> napi::Result<Self::Ok> {
+    self.serialize_str(variant)
+  }
+
+  fn serialize_newtype_struct<T>(self, _name: &'static str, value: &T) -> napi::Result<Self::Ok>
+  where
+    T: Serialize + ?Sized,
+  {
+    value.serialize(self)
+  }
+
+  fn serialize_newtype_variant<T>(
+    self,
+    _name: &'static str,
+    _variant_index: u32,
+    variant: &'static str,
+    value: &T,
+  ) -> napi::Result<Self::Ok>
+  where
+    T: Serialize + ?Sized,
+  {
+    let mut object = self.env.create_object()?;
+    let inner = to_js(self.env, value)?;
+    object.set_named_property(variant, inner)?;
+    Ok(Some(object.into_unknown()))
+  }
+
+  fn serialize_seq(self, len: Option<usize>) -> napi::Result<Self::SerializeSeq> {
+    Ok(SeqWriter {
+      env: self.env,
+      array: self.env.create_array_with_length(len.unwrap_or(0))?,
+      index: 0,
+    })
+  }
+
+  fn serialize_tuple(self, len: usize) -> napi::Result<Self::SerializeTuple> {
+    self.serialize_seq(Some(len))
+  }
+
+  fn serialize_tuple_struct(
+    self,
+    _name: &'static str,
+    len: usize,
+  ) -> napi::Result<Self::SerializeTupleStruct> {
+    self.serialize_seq(Some(len))
+  }
+
+  fn serialize_tuple_variant(
+    self,
+    _name: &'static str,
+    _variant_index: u32,
+    variant: &'static str,
+    len: usize,
+  ) -> napi::Result<Self::SerializeTupleVariant> {
+    Ok(VariantSeqWriter {
+      variant,
+      inner: self.serialize_seq(Some(len))?,
+    })
+  }
+
+  fn serialize_map(self, _len: Option<usize>) -> napi::Result<Self::SerializeMap> {
+    Ok(MapWriter {
+      env: self.env,
+      object: self.env.create_object()?,
+      pending_key: None,
+    })
+  }
+
+  fn serialize_struct(
+    self,
+    _name: &'static str,
+    _len: usize,
+  ) -> napi::Result<Self::SerializeStruct> {
+    Ok(StructWriter {
+      env: self.env,
+      object: self.env.create_object()?,
+    })
+  }
+
+  fn serialize_struct_variant(
+    self,
+    _name: &'static str,
+    _variant_index: u32,
+    variant: &'static str,
+    len: usize,
+  ) -> napi::Result<Self::SerializeStructVariant> {
+    Ok(VariantStructWriter {
+      variant,
+      inner: self.serialize_struct("", len)?,
+    })
+  }
+}
+
+struct SeqWriter<'env> {
+  env: &'env Env,
+  array: JsObject,
+  index: u32,
+}
+
+impl SeqWriter<'_> {
+  fn push<T>(&mut self, value: &T) -> napi::Result<()>
+  where
+    T: Serialize + ?Sized,
+  {
+    self
+      .array
+      .set_element(self.index, to_js(self.env, value)?)?;
+    self.index += 1;
+    Ok(())
+  }
+}
+
+impl ser::SerializeSeq for SeqWriter<'_> {
+  type Ok = Option<JsUnknown>;
+  type Error = napi::Error;
+
+  fn serialize_element<T>(&mut self, value: &T) -> napi::Result<()>
+  where
+    T: Serialize + ?Sized,
+  {
+    self.push(value)
+  }
+
+  fn end(self) -> napi::Result<Self::Ok> {
+    Ok(Some(self.array.into_unknown()))
+  }
+}
+
+impl ser::SerializeTuple for SeqWriter<'_> {
+  type Ok = Option<JsUnknown>;
+  type Error = napi::Error;
+
+  fn serialize_element<T>(&mut self, value: &T) -> napi::Result<()>
+  where
+    T: Serialize + ?Sized,
+  {
+    self.push(value)
+  }
+
+  fn end(self) -> napi::Result<Self::Ok> {
+    Ok(Some(self.array.into_unknown()))
+  }
+}
+
+impl ser::SerializeTupleStruct for SeqWriter<'_> {
+  type Ok = Option<JsUnknown>;
+  type Error = napi::Error;
+
+  fn serialize_field<T>(&mut self, value: &T) -> napi::Result<()>
+  where
+    T: Serialize + ?Sized,
+  {
+    self.push(value)
+  }
+
+  fn end(self) -> napi::Result<Self::Ok> {
+    Ok(Some(self.array.into_unknown()))
+  }
+}
+
+struct VariantSeqWriter<'env> {
+  variant: &'static str,
+  inner: SeqWriter<'env>,
+}
+
+impl ser::SerializeTupleVariant for VariantSeqWriter<'_> {
+  type Ok = Option<JsUnknown>;
+  type Error = napi::Error;
+
+  fn serialize_field<T>(&mut self, value: &T) -> napi::Result<()>
+  where
+    T: Serialize + ?Sized,
+  {
+    self.inner.push(value)
+  }
+
+  fn end(self) -> napi::Result<Self::Ok> {
+    let mut object = self.inner.env.create_object()?;
+    object.set_named_property(self.variant, self.inner.array)?;
+    Ok(Some(object.into_unknown()))
+  }
+}
+
+struct MapWriter<'env> {
+  env: &'env Env,
+  object: JsObject,
+  pending_key: Option<JsString>,
+}
+
+impl ser::SerializeMap for MapWriter<'_> {
+  type Ok = Option<JsUnknown>;
+  type Error = napi::Error;
+
+  fn serialize_key<T>(&mut self, key: &T) -> napi::Result<()>
+  where
+    T: Serialize + ?Sized,
+  {
+    let key = to_js(self.env, key)?;
+    self.pending_key = Some(key.coerce_to_string()?);
+    Ok(())
+  }
+
+  fn serialize_value<T>(&mut self, value: &T) -> napi::Result<()>
+  where
+    T: Serialize + ?Sized,
+  {
+    let key = self
+      .pending_key
+      .take()
+      .ok_or_else(|| napi::Error::from_reason("Map value serialized before its key".to_string()))?;
+    if let Some(value) = value.serialize(NapiRefSerializer { env: self.env })? {
+      self.object.set_property(key, value)?;
+    }
+    Ok(())
+  }
+
+  fn end(self) -> napi::Result<Self::Ok> {
+    Ok(Some(self.object.into_unknown()))
+  }
+}
+
+struct StructWriter<'env> {
+  env: &'env Env,
+  object: JsObject,
+}
+
+impl ser::SerializeStruct for StructWriter<'_> {
+  type Ok = Option<JsUnknown>;
+  type Error = napi::Error;
+
+  fn serialize_field<T>(&mut self, key: &'static str, value: &T) -> napi::Result<()>
+  where
+    T: Serialize + ?Sized,
+  {
+    if let Some(value) = value.serialize(NapiRefSerializer { env: self.env })? {
+      self.object.set_named_property(key, value)?;
+    }
+    Ok(())
+  }
+
+  fn end(self) -> napi::Result<Self::Ok> {
+    Ok(Some(self.object.into_unknown()))
+  }
+}
+
+struct VariantStructWriter<'env> {
+  variant: &'static str,
+  inner: StructWriter<'env>,
+}
+
+impl ser::SerializeStructVariant for VariantStructWriter<'_> {
+  type Ok = Option<JsUnknown>;
+  type Error = napi::Error;
+
+  fn serialize_field<T>(&mut self, key: &'static str, value: &T) -> napi::Result<()>
+  where
+    T: Serialize + ?Sized,
+  {
+    ser::SerializeStruct::serialize_field(&mut self.inner, key, value)
+  }
+
+  fn end(self) -> napi::Result<Self::Ok> {
+    let mut object = self.inner.env.create_object()?;
+    object.set_named_property(self.variant, self.inner.object)?;
+    Ok(Some(object.into_unknown()))
+  }
+}
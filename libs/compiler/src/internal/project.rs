@@ -21,18 +21,19 @@ use foundry_config::{Config as FoundryConfig, SolcReq};
 
 use crate::internal::config::{CompilerConfig, CompilerConfigOptions, SolcConfig};
 use crate::internal::errors::{map_err_with_context, Error, Result};
+use crate::internal::metrics;
 use crate::internal::path::{canonicalize_path, canonicalize_with_base, ProjectPaths};
 use crate::internal::settings::CompilerSettingsOptions;
 use crate::internal::vyper;
 
-#[derive(Clone, Debug)]
+#[derive(Clone, Debug, serde::Serialize, serde::Deserialize)]
 pub enum ProjectLayout {
   Hardhat,
   Foundry,
   Synthetic,
 }
 
-#[derive(Clone)]
+#[derive(Clone, serde::Serialize, serde::Deserialize)]
 pub struct ProjectContext {
   pub layout: ProjectLayout,
   pub root: PathBuf,
@@ -102,7 +103,7 @@ pub fn build_project(
   builder = builder.set_no_artifacts(config.no_artifacts);
   builder = builder.set_build_info(config.build_info_enabled);
   builder = builder.set_slashed_paths(config.slash_paths);
-  if let Some(solc_jobs) = config.solc_jobs {
+  if let Some(solc_jobs) = config.max_parallel_jobs.or(config.solc_jobs) {
     if solc_jobs == 1 {
       builder = builder.single_solc_jobs();
     } else if solc_jobs > 1 {
@@ -280,6 +281,7 @@ pub struct FoundryAdapter;
 
 impl FoundryAdapter {
   pub fn load(root: &Path) -> Result<(CompilerConfigOptions, ProjectContext)> {
+    let _span = metrics::span(metrics::Phase::ProjectResolution);
     let figment = FoundryConfig::figment_with_root(root);
     let config = map_err_with_context(
       FoundryConfig::try_from(figment),
@@ -390,6 +392,7 @@ pub struct HardhatAdapter;
 
 impl HardhatAdapter {
   pub fn load(root: &Path) -> Result<(CompilerConfigOptions, ProjectContext)> {
+    let _span = metrics::span(metrics::Phase::ProjectResolution);
     let mut paths = map_err_with_context(
       ProjectPathsConfig::hardhat(root),
       "Failed to create hardhat project paths",
@@ -0,0 +1,317 @@
+use std::collections::BTreeMap;
+use std::fs;
+use std::path::{Path, PathBuf};
+use std::sync::{Mutex, OnceLock};
+
+use log::{debug, warn};
+
+use crate::internal::config::CompilerConfigOptions;
+use crate::internal::errors::Result;
+use crate::internal::project::{FoundryAdapter, ProjectContext};
+
+const LOG_TARGET: &str = "tevm::compiler.project.snapshot";
+
+/// Magic prefix identifying the snapshot format. The trailing digits are the format version: bump
+/// them whenever the serialized shape of [`CompilerConfigOptions`] or [`ProjectContext`] changes so
+/// snapshots written by older builds are re-resolved instead of misread.
+const MAGIC: &[u8; 8] = b"TEVMPS01";
+
+const SNAPSHOT_FILE: &str = "project-snapshot.bin";
+
+/// Resolved project state persisted between processes. The digest pins the snapshot to the exact
+/// configuration inputs it was derived from; a mismatch means `foundry.toml` or the remappings
+/// changed and the figment resolution has to run again.
+#[derive(serde::Serialize, serde::Deserialize)]
+struct Snapshot {
+  digest: [u8; 32],
+  overrides: CompilerConfigOptions,
+  context: ProjectContext,
+}
+
+/// Process-wide memory tier above the on-disk snapshot, shared by every compiler created from the
+/// same root. Entries are pinned to the configuration digest they were resolved under, so editing
+/// `foundry.toml` or `remappings.txt` reads as a miss, and can be dropped explicitly through
+/// [`invalidate`].
+struct ResolutionEntry {
+  digest: [u8; 32],
+  overrides: CompilerConfigOptions,
+  context: ProjectContext,
+}
+
+fn resolution_cache() -> &'static Mutex<BTreeMap<PathBuf, ResolutionEntry>> {
+  static CACHE: OnceLock<Mutex<BTreeMap<PathBuf, ResolutionEntry>>> = OnceLock::new();
+  CACHE.get_or_init(|| Mutex::new(BTreeMap::new()))
+}
+
+/// Resolves a Foundry project, serving the result from the process-wide memory cache or the
+/// on-disk snapshot when the configuration inputs are unchanged. Loading `foundry.toml` through
+/// figment, resolving remappings, and rebuilding the path config re-stats `lib/` and
+/// `node_modules` trees and costs hundreds of milliseconds per instantiation; hashing two files
+/// and cloning the cached resolution is orders of magnitude cheaper, so warm
+/// `Compiler.fromFoundryRoot` calls skip the resolution entirely.
+pub fn resolve_foundry(root: &Path) -> Result<(CompilerConfigOptions, ProjectContext)> {
+  let digest = config_digest(root);
+  if let Some(digest) = digest.as_ref() {
+    if let Ok(cache) = resolution_cache().lock() {
+      if let Some(entry) = cache.get(root) {
+        if entry.digest == *digest.as_bytes() {
+          debug!(
+            target: LOG_TARGET,
+            "reusing in-memory project resolution for {}",
+            root.display()
+          );
+          return Ok((entry.overrides.clone(), entry.context.clone()));
+        }
+      }
+    }
+    if let Some((overrides, context)) = load(root, digest) {
+      debug!(
+        target: LOG_TARGET,
+        "reusing project snapshot for {}",
+        root.display()
+      );
+      remember(root, digest, &overrides, &context);
+      return Ok((overrides, context));
+    }
+  }
+
+  let (overrides, context) = FoundryAdapter::load(root)?;
+  if let Some(digest) = digest {
+    remember(root, &digest, &overrides, &context);
+    store(root, &digest, &overrides, &context);
+  }
+  Ok((overrides, context))
+}
+
+/// Drops cached resolutions so the next `fromFoundryRoot` call re-resolves from scratch. `Some`
+/// invalidates a single project root; `None` invalidates every root resolved by this process.
+/// Both tiers are dropped: the memory entry and the on-disk snapshot it would be refilled from.
+pub fn invalidate(root: Option<&Path>) {
+  let Ok(mut cache) = resolution_cache().lock() else {
+    return;
+  };
+  match root {
+    Some(root) => {
+      cache.remove(root);
+      let _ = fs::remove_file(snapshot_path(root));
+    }
+    None => {
+      for root in cache.keys() {
+        let _ = fs::remove_file(snapshot_path(root));
+      }
+      cache.clear();
+    }
+  }
+}
+
+fn remember(
+  root: &Path,
+  digest: &blake3::Hash,
+  overrides: &CompilerConfigOptions,
+  context: &ProjectContext,
+) {
+  if let Ok(mut cache) = resolution_cache().lock() {
+    cache.insert(
+      root.to_path_buf(),
+      ResolutionEntry {
+        digest: *digest.as_bytes(),
+        overrides: overrides.clone(),
+        context: context.clone(),
+      },
+    );
+  }
+}
+
+/// Digest of the inputs the Foundry resolution depends on. `None` when `foundry.toml` cannot be
+/// read, in which case snapshotting is skipped and resolution always runs fresh.
+fn config_digest(root: &Path) -> Option<blake3::Hash> {
+  let mut hasher = blake3::Hasher::new();
+  hasher.update(&fs::read(root.join("foundry.toml")).ok()?);
+  if let Ok(remappings) = fs::read(root.join("remappings.txt")) {
+    hasher.update(&remappings);
+  }
+  Some(hasher.finalize())
+}
+
+fn snapshot_path(root: &Path) -> PathBuf {
+  root.join(".tevm").join(SNAPSHOT_FILE)
+}
+
+/// Loads the snapshot for `root` when it matches `digest`. Unreadable, version-mismatched, or
+/// stale snapshots are removed and treated as misses — the snapshot is an optimisation, never an
+/// error source.
+fn load(root: &Path, digest: &blake3::Hash) -> Option<(CompilerConfigOptions, ProjectContext)> {
+  let path = snapshot_path(root);
+  let bytes = fs::read(&path).ok()?;
+  match decode(&bytes, digest) {
+    Some(snapshot) => Some((snapshot.overrides, snapshot.context)),
+    None => {
+      debug!(
+        target: LOG_TARGET,
+        "discarding stale project snapshot {}",
+        path.display()
+      );
+      let _ = fs::remove_file(&path);
+      None
+    }
+  }
+}
+
+fn decode(bytes: &[u8], digest: &blake3::Hash) -> Option<Snapshot> {
+  let payload = bytes.strip_prefix(MAGIC)?;
+  let snapshot: Snapshot = rmp_serde::from_slice(payload).ok()?;
+  (snapshot.digest == *digest.as_bytes()).then_some(snapshot)
+}
+
+/// Persists the resolved project under `root`. Failures are logged and swallowed; the caller
+/// already has the freshly resolved project in hand.
+fn store(
+  root: &Path,
+  digest: &blake3::Hash,
+  overrides: &CompilerConfigOptions,
+  context: &ProjectContext,
+) {
+  if let Err(err) = try_store(root, digest, overrides, context) {
+    warn!(
+      target: LOG_TARGET,
+      "failed to persist project snapshot for {}: {err}",
+      root.display()
+    );
+  }
+}
+
+fn try_store(
+  root: &Path,
+  digest: &blake3::Hash,
+  overrides: &CompilerConfigOptions,
+  context: &ProjectContext,
+) -> std::io::Result<()> {
+  let dir = root.join(".tevm");
+  fs::create_dir_all(&dir)?;
+
+  let snapshot = Snapshot {
+    digest: *digest.as_bytes(),
+    overrides: overrides.clone(),
+    context: context.clone(),
+  };
+  let mut payload = Vec::with_capacity(MAGIC.len() + 1024);
+  payload.extend_from_slice(MAGIC);
+  // Named-field encoding: the Foundry settings structs skip absent fields when serializing, which
+  // MessagePack's positional struct layout cannot round-trip.
+  rmp_serde::encode::write_named(&mut payload, &snapshot)
+    .map_err(|err| std::io::Error::other(err.to_string()))?;
+
+  // Write-then-rename keeps concurrent readers from ever seeing a half-written snapshot.
+  let staging = dir.join(format!("{SNAPSHOT_FILE}.tmp-{}", std::process::id()));
+  fs::write(&staging, &payload)?;
+  fs::rename(&staging, snapshot_path(root))
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+  use tempfile::tempdir;
+
+  fn write_foundry_fixture(root: &Path) {
+    for dir in ["src", "test", "script", "lib"] {
+      fs::create_dir_all(root.join(dir)).expect("create dir");
+    }
+    fs::write(root.join("foundry.toml"), "[profile.default]\n").expect("foundry.toml");
+  }
+
+  #[test]
+  fn foundry_resolution_round_trips_through_the_snapshot() {
+    let temp = tempdir().expect("tempdir");
+    write_foundry_fixture(temp.path());
+
+    let (fresh_overrides, fresh_context) = resolve_foundry(temp.path()).expect("fresh resolve");
+    assert!(
+      snapshot_path(temp.path()).exists(),
+      "first resolution should write the snapshot"
+    );
+
+    let digest = config_digest(temp.path()).expect("digest");
+    let (cached_overrides, cached_context) =
+      load(temp.path(), &digest).expect("snapshot should satisfy an unchanged digest");
+    assert_eq!(cached_context.root, fresh_context.root);
+    assert_eq!(cached_context.paths.sources, fresh_context.paths.sources);
+    assert_eq!(
+      cached_context.paths.remappings,
+      fresh_context.paths.remappings
+    );
+    assert_eq!(
+      cached_overrides.cache_enabled,
+      fresh_overrides.cache_enabled
+    );
+    assert_eq!(
+      cached_overrides.library_paths,
+      fresh_overrides.library_paths
+    );
+
+    let (resolved_overrides, resolved_context) =
+      resolve_foundry(temp.path()).expect("warm resolve");
+    assert_eq!(resolved_context.root, fresh_context.root);
+    assert_eq!(resolved_overrides.allow_paths, fresh_overrides.allow_paths);
+  }
+
+  #[test]
+  fn editing_the_configuration_invalidates_the_snapshot() {
+    let temp = tempdir().expect("tempdir");
+    write_foundry_fixture(temp.path());
+
+    resolve_foundry(temp.path()).expect("fresh resolve");
+    let stale_digest = config_digest(temp.path()).expect("digest");
+
+    fs::write(
+      temp.path().join("foundry.toml"),
+      "[profile.default]\noptimizer = true\n",
+    )
+    .expect("rewrite foundry.toml");
+
+    let digest = config_digest(temp.path()).expect("digest");
+    assert_ne!(digest, stale_digest);
+    assert!(
+      load(temp.path(), &digest).is_none(),
+      "changed configuration should read as a miss"
+    );
+    assert!(
+      !snapshot_path(temp.path()).exists(),
+      "stale snapshot should be discarded"
+    );
+  }
+
+  #[test]
+  fn warm_resolution_is_served_from_memory_without_the_snapshot_file() {
+    let temp = tempdir().expect("tempdir");
+    write_foundry_fixture(temp.path());
+
+    let (_, fresh_context) = resolve_foundry(temp.path()).expect("fresh resolve");
+    fs::remove_file(snapshot_path(temp.path())).expect("remove snapshot");
+
+    let (_, warm_context) = resolve_foundry(temp.path()).expect("warm resolve");
+    assert_eq!(warm_context.root, fresh_context.root);
+    assert!(
+      !snapshot_path(temp.path()).exists(),
+      "memory hit should not rewrite the snapshot"
+    );
+  }
+
+  #[test]
+  fn invalidate_drops_the_memory_entry_and_the_snapshot() {
+    let temp = tempdir().expect("tempdir");
+    write_foundry_fixture(temp.path());
+
+    resolve_foundry(temp.path()).expect("fresh resolve");
+    invalidate(Some(temp.path()));
+    assert!(
+      !snapshot_path(temp.path()).exists(),
+      "invalidation should remove the snapshot file"
+    );
+
+    resolve_foundry(temp.path()).expect("re-resolve");
+    assert!(
+      snapshot_path(temp.path()).exists(),
+      "re-resolution after invalidation should run fresh and rewrite the snapshot"
+    );
+  }
+}
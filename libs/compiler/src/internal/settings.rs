@@ -465,6 +465,69 @@ pub fn default_output_selection() -> OutputSelection {
   selection
 }
 
+/// Output keys accepted by the per-call `outputs` fast mode, paired with the solc selection path
+/// each expands to. `ast` is special-cased below because solc scopes it to the file level.
+const REQUESTABLE_OUTPUTS: &[(&str, &str)] = &[
+  ("abi", "abi"),
+  ("bytecode", "evm.bytecode"),
+  ("deployedBytecode", "evm.deployedBytecode"),
+  ("metadata", "metadata"),
+  ("storageLayout", "storageLayout"),
+  ("methodIdentifiers", "evm.methodIdentifiers"),
+  ("gasEstimates", "evm.gasEstimates"),
+];
+
+/// Expands a caller-facing `outputs` list into the minimal solc `OutputSelection`, so solc skips
+/// generating every section the caller did not ask for.
+pub fn minimal_output_selection(outputs: &[String]) -> Result<OutputSelection> {
+  if outputs.is_empty() {
+    return Err(crate::internal::errors::napi_error(
+      "`outputs` requires at least one selector. Omit the option entirely to request the default \
+       output selection.",
+    ));
+  }
+
+  let mut contract_outputs = Vec::new();
+  let mut file_outputs = Vec::new();
+  for output in outputs {
+    if output == "ast" {
+      if !file_outputs.contains(&"ast".to_string()) {
+        file_outputs.push("ast".to_string());
+      }
+      continue;
+    }
+    let selector = REQUESTABLE_OUTPUTS
+      .iter()
+      .find(|(key, _)| key == output)
+      .map(|(_, selector)| selector.to_string())
+      .ok_or_else(|| {
+        let known = REQUESTABLE_OUTPUTS
+          .iter()
+          .map(|(key, _)| format!("\"{key}\""))
+          .collect::<Vec<_>>()
+          .join(", ");
+        crate::internal::errors::napi_error(format!(
+          "Unknown output selector \"{output}\". Supported selectors: {known}, \"ast\". Use \
+           `solcSettings.outputSelection` for selections beyond this list."
+        ))
+      })?;
+    if !contract_outputs.contains(&selector) {
+      contract_outputs.push(selector);
+    }
+  }
+
+  let mut file_selection = BTreeMap::new();
+  if !contract_outputs.is_empty() {
+    file_selection.insert("*".to_string(), contract_outputs);
+  }
+  if !file_outputs.is_empty() {
+    file_selection.insert(String::new(), file_outputs);
+  }
+  let mut selection = BTreeMap::new();
+  selection.insert("*".to_string(), file_selection);
+  Ok(OutputSelection(selection))
+}
+
 pub fn output_selection_is_effectively_empty(selection: &OutputSelection) -> bool {
   let map = selection.as_ref();
   if map.is_empty() {
@@ -727,6 +790,30 @@ mod tests {
     );
   }
 
+  #[test]
+  fn minimal_output_selection_maps_selectors_and_scopes_ast_to_file_level() {
+    let outputs = ["bytecode".to_string(), "abi".to_string(), "ast".to_string()];
+    let selection = minimal_output_selection(&outputs).expect("selection");
+    let files = selection.as_ref().get("*").expect("file entry");
+    assert_eq!(
+      files.get("*").expect("contract outputs"),
+      &vec!["evm.bytecode".to_string(), "abi".to_string()]
+    );
+    assert_eq!(
+      files.get("").expect("file outputs"),
+      &vec!["ast".to_string()]
+    );
+  }
+
+  #[test]
+  fn minimal_output_selection_rejects_unknown_and_empty_selectors() {
+    let error = minimal_output_selection(&["evm.bytecode".to_string()]).expect_err("unknown");
+    assert!(error.reason.contains("Unknown output selector"));
+    assert!(error.reason.contains("\"bytecode\""));
+    let error = minimal_output_selection(&[]).expect_err("empty");
+    assert!(error.reason.contains("at least one selector"));
+  }
+
   #[test]
   fn merge_preserves_base_when_no_overrides() {
     let base = Settings::default();
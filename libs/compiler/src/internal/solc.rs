@@ -1,6 +1,8 @@
-use std::sync::{Mutex, OnceLock};
+use std::collections::HashMap;
+use std::sync::{Arc, Mutex, OnceLock};
 
-use log::error;
+use arc_swap::ArcSwap;
+use log::{debug, error};
 use semver::Version;
 
 use foundry_compilers::solc::{Solc, SolcLanguage};
@@ -10,6 +12,38 @@ use super::errors::{map_err_with_context, to_napi_result, Error, Result};
 
 const LOG_TARGET: &str = "tevm::solc";
 
+/// Immutable snapshot of the svm install directory, swapped atomically so `ensure_installed` on
+/// the hot path is a lock-free map lookup instead of a filesystem scan per compile.
+fn installed_registry() -> &'static ArcSwap<HashMap<Version, Solc>> {
+  static REGISTRY: OnceLock<ArcSwap<HashMap<Version, Solc>>> = OnceLock::new();
+  REGISTRY.get_or_init(|| ArcSwap::from_pointee(scan_installed_versions()))
+}
+
+fn scan_installed_versions() -> HashMap<Version, Solc> {
+  let mut installed = HashMap::new();
+  for version in Solc::installed_versions() {
+    match Solc::find_svm_installed_version(&version) {
+      Ok(Some(solc)) => {
+        installed.insert(version, solc);
+      }
+      Ok(None) => {}
+      Err(err) => {
+        debug!(
+          target: LOG_TARGET,
+          "skipping unreadable solc install {version}: {err}"
+        );
+      }
+    }
+  }
+  installed
+}
+
+/// Rebuilds the registry snapshot from disk. Called after installs complete and when a lookup
+/// misses but the binary exists on disk (e.g. installed by another process sharing the svm dir).
+pub(crate) fn refresh_installed_registry() {
+  installed_registry().store(Arc::new(scan_installed_versions()));
+}
+
 pub(crate) const DEFAULT_SOLC_VERSION: &str = "0.8.30";
 
 pub(crate) fn default_language() -> SolcLanguage {
@@ -37,10 +71,20 @@ pub(crate) fn ensure_installed(version: &Version) -> Result<Solc> {
 }
 
 pub(crate) fn find_installed_version(version: &Version) -> Result<Option<Solc>> {
+  let normalized = Version::new(version.major, version.minor, version.patch);
+  if let Some(solc) = installed_registry().load().get(&normalized) {
+    return Ok(Some(solc.clone()));
+  }
+
+  // Miss: fall back to the filesystem in case the version appeared after the snapshot was taken,
+  // and fold it into a fresh snapshot when it did.
   let maybe_solc = map_err_with_context(
     Solc::find_svm_installed_version(version),
     "Failed to inspect solc versions",
   )?;
+  if maybe_solc.is_some() {
+    refresh_installed_registry();
+  }
   Ok(maybe_solc)
 }
 
@@ -56,7 +100,9 @@ pub(crate) fn install_version(version: &Version) -> Result<()> {
   map_err_with_context(
     Solc::blocking_install(version).map(|_| ()),
     "Failed to install solc version",
-  )
+  )?;
+  refresh_installed_registry();
+  Ok(())
 }
 
 pub struct InstallSolcTask {
@@ -85,8 +131,9 @@ impl Task for InstallSolcTask {
     to_napi_result(map_err_with_context(
       Solc::blocking_install(&self.version),
       "Failed to install solc version",
-    ))
-    .map(|_| ())
+    ))?;
+    refresh_installed_registry();
+    Ok(())
   }
 
   fn resolve(&mut self, _env: Env, _output: Self::Output) -> napi::Result<Self::JsValue> {
@@ -134,6 +181,18 @@ mod tests {
     assert!(result.is_none());
   }
 
+  #[test]
+  fn registry_refresh_keeps_lookups_consistent_with_disk() {
+    refresh_installed_registry();
+    let snapshot = installed_registry().load();
+    for version in snapshot.keys() {
+      assert!(is_version_installed(version).expect("is installed"));
+    }
+    assert!(find_installed_version(&Version::new(0, 0, 0))
+      .expect("find version")
+      .is_none());
+  }
+
   #[test]
   fn is_version_installed_false_for_missing_version() {
     let version = Version::new(0, 0, 0);
@@ -0,0 +1,209 @@
+use std::collections::BTreeMap;
+use std::sync::{Arc, Condvar, Mutex, OnceLock};
+
+use log::info;
+use semver::Version;
+
+use foundry_compilers::solc::Solc;
+
+use super::errors::{Error, Result};
+use super::solc;
+
+const LOG_TARGET: &str = "tevm::solc_pool";
+
+/// Process-wide pool of warm `solc` handles keyed by version. Resolving a handle through
+/// `Solc::find_svm_installed_version` walks the svm install directory on every call, which dominates
+/// wall time when parsing hundreds of small fragments per second. The pool resolves each installed
+/// version once, then hands out shared handles guarded by a permit that bounds how many solc child
+/// processes run concurrently.
+///
+/// Stock `solc` reads one standard-JSON document per process, so the pool cannot keep literal
+/// processes alive between invocations; it keeps the resolved handles warm and gates process
+/// concurrency instead.
+struct SolcPool {
+  handles: Mutex<BTreeMap<Version, Arc<Solc>>>,
+  gate: ProcessGate,
+}
+
+/// Counting gate implemented with a mutex and condvar so we avoid pulling an async runtime into the
+/// crate. Capacity changes take effect for subsequent acquisitions. Shared with the Vyper pool
+/// (`crate::internal::vyper`), which gates its child processes the same way.
+pub(crate) struct ProcessGate {
+  log_target: &'static str,
+  active: Mutex<usize>,
+  capacity: Mutex<usize>,
+  released: Condvar,
+}
+
+impl ProcessGate {
+  pub(crate) fn new(log_target: &'static str, capacity: usize) -> Self {
+    Self {
+      log_target,
+      active: Mutex::new(0),
+      capacity: Mutex::new(capacity.max(1)),
+      released: Condvar::new(),
+    }
+  }
+
+  pub(crate) fn set_capacity(&self, capacity: usize) -> Result<()> {
+    let mut current = self
+      .capacity
+      .lock()
+      .map_err(|err| Error::new(format!("Compiler pool capacity mutex poisoned: {err}")))?;
+    let next = capacity.max(1);
+    if *current != next {
+      info!(
+        target: self.log_target,
+        "pool capacity updated {} -> {}",
+        *current,
+        next
+      );
+      *current = next;
+      self.released.notify_all();
+    }
+    Ok(())
+  }
+
+  pub(crate) fn acquire(&self) -> Result<()> {
+    let mut active = self
+      .active
+      .lock()
+      .map_err(|err| Error::new(format!("Compiler pool mutex poisoned: {err}")))?;
+    loop {
+      let capacity = *self
+        .capacity
+        .lock()
+        .map_err(|err| Error::new(format!("Compiler pool capacity mutex poisoned: {err}")))?;
+      if *active < capacity {
+        *active += 1;
+        return Ok(());
+      }
+      active = self
+        .released
+        .wait(active)
+        .map_err(|err| Error::new(format!("Compiler pool mutex poisoned: {err}")))?;
+    }
+  }
+
+  pub(crate) fn release(&self) {
+    if let Ok(mut active) = self.active.lock() {
+      *active = active.saturating_sub(1);
+      self.released.notify_one();
+    }
+  }
+}
+
+pub(crate) fn default_capacity() -> usize {
+  std::thread::available_parallelism()
+    .map(|parallelism| parallelism.get())
+    .unwrap_or(1)
+}
+
+fn pool() -> &'static SolcPool {
+  static POOL: OnceLock<SolcPool> = OnceLock::new();
+  POOL.get_or_init(|| SolcPool {
+    handles: Mutex::new(BTreeMap::new()),
+    gate: ProcessGate::new(LOG_TARGET, default_capacity()),
+  })
+}
+
+/// A warm solc handle together with its concurrency permit. The permit is returned to the pool when
+/// the checkout is dropped, so hold it exactly as long as the compiler invocation it guards.
+#[derive(Debug)]
+pub(crate) struct SolcCheckout {
+  solc: Arc<Solc>,
+}
+
+impl SolcCheckout {
+  pub fn solc(&self) -> &Solc {
+    &self.solc
+  }
+}
+
+impl Drop for SolcCheckout {
+  fn drop(&mut self) {
+    pool().gate.release();
+  }
+}
+
+/// Check out a warm handle for `version`, resolving and caching it on first use. `pool_size`
+/// overrides the maximum number of concurrently running solc processes; `None` keeps the current
+/// capacity (one per logical CPU by default). Blocks until a permit is available.
+pub(crate) fn checkout(version: &Version, pool_size: Option<usize>) -> Result<SolcCheckout> {
+  let pool = pool();
+  if let Some(size) = pool_size {
+    pool.gate.set_capacity(size)?;
+  }
+
+  let solc = {
+    let mut handles = pool
+      .handles
+      .lock()
+      .map_err(|err| Error::new(format!("Solc pool mutex poisoned: {err}")))?;
+    match handles.get(version) {
+      Some(solc) => Arc::clone(solc),
+      None => {
+        let resolved = Arc::new(solc::ensure_installed(version)?);
+        info!(
+          target: LOG_TARGET,
+          "warmed solc {} handle for reuse",
+          version
+        );
+        handles.insert(version.clone(), Arc::clone(&resolved));
+        resolved
+      }
+    }
+  };
+
+  pool.gate.acquire()?;
+  Ok(SolcCheckout { solc })
+}
+
+#[cfg(test)]
+mod tests {
+  use super::*;
+
+  #[test]
+  fn checkout_errors_for_missing_version() {
+    let version = Version::new(0, 0, 0);
+    let err = checkout(&version, None).unwrap_err();
+    assert!(
+      err.to_string().contains("is not installed"),
+      "unexpected message: {}",
+      err
+    );
+  }
+
+  #[test]
+  fn gate_releases_permits_on_drop() {
+    let gate = ProcessGate::new(LOG_TARGET, 1);
+    gate.acquire().expect("first acquire");
+    gate.release();
+    gate.acquire().expect("acquire after release");
+    gate.release();
+  }
+
+  #[test]
+  fn gate_capacity_never_drops_below_one() {
+    let gate = ProcessGate::new(LOG_TARGET, 4);
+    gate.set_capacity(0).expect("set capacity");
+    gate.acquire().expect("acquire with clamped capacity");
+    gate.release();
+  }
+
+  #[test]
+  fn gate_blocks_until_capacity_frees_up() {
+    let gate = std::sync::Arc::new(ProcessGate::new(LOG_TARGET, 1));
+    gate.acquire().expect("saturate gate");
+
+    let waiter = std::sync::Arc::clone(&gate);
+    let handle = std::thread::spawn(move || {
+      waiter.acquire().expect("acquire once released");
+      waiter.release();
+    });
+
+    std::thread::sleep(std::time::Duration::from_millis(25));
+    gate.release();
+    handle.join().expect("waiter thread");
+  }
+}
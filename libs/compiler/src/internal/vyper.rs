@@ -1,8 +1,15 @@
+use std::collections::BTreeMap;
 use std::path::PathBuf;
+use std::sync::{Arc, Mutex, OnceLock};
+
+use log::info;
 
 use foundry_compilers::compilers::vyper::Vyper;
 
 use crate::internal::errors::{Error, Result};
+use crate::internal::solc_pool::{default_capacity, ProcessGate};
+
+const LOG_TARGET: &str = "tevm::vyper_pool";
 
 pub fn default_path() -> PathBuf {
   PathBuf::from("vyper")
@@ -18,6 +25,78 @@ pub fn ensure_installed(path: Option<PathBuf>) -> Result<Vyper> {
   })
 }
 
+/// Process-wide pool of warm `vyper` handles keyed by executable path, mirroring
+/// `crate::internal::solc_pool`. `Vyper::new` shells out for `vyper --version` on every call, so
+/// the per-module compile path would otherwise re-probe the binary once per module; the pool
+/// probes each executable once and gates how many vyper child processes run concurrently.
+struct VyperPool {
+  handles: Mutex<BTreeMap<PathBuf, Arc<Vyper>>>,
+  gate: ProcessGate,
+}
+
+fn pool() -> &'static VyperPool {
+  static POOL: OnceLock<VyperPool> = OnceLock::new();
+  POOL.get_or_init(|| VyperPool {
+    handles: Mutex::new(BTreeMap::new()),
+    gate: ProcessGate::new(LOG_TARGET, default_capacity()),
+  })
+}
+
+/// A warm vyper handle together with its concurrency permit. The permit is returned to the pool
+/// when the checkout is dropped, so hold it exactly as long as the compiler invocation it guards.
+#[derive(Debug)]
+pub(crate) struct VyperCheckout {
+  vyper: Arc<Vyper>,
+}
+
+impl VyperCheckout {
+  pub fn vyper(&self) -> &Vyper {
+    &self.vyper
+  }
+}
+
+impl Drop for VyperCheckout {
+  fn drop(&mut self) {
+    pool().gate.release();
+  }
+}
+
+/// Check out a warm handle for the executable at `path` (the `PATH`-resolved `vyper` when `None`),
+/// probing and caching it on first use. `jobs` overrides the maximum number of concurrently
+/// running vyper processes; `None` keeps the current capacity (one per logical CPU by default).
+/// Blocks until a permit is available.
+pub(crate) fn checkout(path: Option<PathBuf>, jobs: Option<usize>) -> Result<VyperCheckout> {
+  let pool = pool();
+  if let Some(jobs) = jobs {
+    pool.gate.set_capacity(jobs)?;
+  }
+
+  let key = path.unwrap_or_else(default_path);
+  let vyper = {
+    let mut handles = pool
+      .handles
+      .lock()
+      .map_err(|err| Error::new(format!("Vyper pool mutex poisoned: {err}")))?;
+    match handles.get(&key) {
+      Some(vyper) => Arc::clone(vyper),
+      None => {
+        let resolved = Arc::new(ensure_installed(Some(key.clone()))?);
+        info!(
+          target: LOG_TARGET,
+          "warmed vyper {} handle for reuse ({})",
+          resolved.version,
+          key.display()
+        );
+        handles.insert(key, Arc::clone(&resolved));
+        resolved
+      }
+    }
+  };
+
+  pool.gate.acquire()?;
+  Ok(VyperCheckout { vyper })
+}
+
 #[cfg(test)]
 mod tests {
   use super::*;
@@ -33,4 +112,17 @@ mod tests {
     let path = PathBuf::from("/definitely/missing/vyper");
     assert!(ensure_installed(Some(path)).is_err());
   }
+
+  #[test]
+  fn checkout_errors_for_missing_binary() {
+    let path = PathBuf::from("/definitely/missing/vyper");
+    let err = checkout(Some(path), None).unwrap_err();
+    assert!(
+      err
+        .to_string()
+        .contains("Failed to initialise Vyper compiler"),
+      "unexpected message: {}",
+      err
+    );
+  }
 }
@@ -7,7 +7,8 @@ mod contract;
 mod internal;
 
 pub use ast::{
-  Ast, FragmentTarget as AstFragmentTarget, SourceTarget as AstSourceTarget, State as AstState,
+  Ast, FragmentTarget as AstFragmentTarget, ShadowTemplate, SourceTarget as AstSourceTarget,
+  State as AstState,
 };
 pub use compiler::{
   core::{
@@ -18,16 +19,28 @@ pub use compiler::{
     from_standard_json, into_core_compile_output, CompilerError, JsCompileOutput,
     JsSourceArtifacts, SecondarySourceLocation, SeverityLevel, SourceLocation,
   },
-  CompilationInput, Compiler,
+  CompilationInput, Compiler, JsCompilerWatcher,
 };
 pub use contract::{
   Contract as ContractOutput, ContractBytecode, ContractState, ImmutableSlot, JsContract,
-  JsContractState,
+  JsContractState, LazySection,
 };
 pub use internal::config::{
   AstConfig, AstConfigOptions, CompilerConfig, CompilerConfigOptions, JsAstConfigOptions,
   JsCompilerConfigOptions, ResolveConflictStrategy, SolcConfig, SolcConfigOptions,
 };
 pub use internal::errors::{Error, Result};
+pub use internal::metrics::{JsCacheRateMetrics, JsCompilerMetrics, JsPhaseMetrics};
 pub use internal::path::ProjectPaths;
 pub use internal::settings::{CompilerSettingsOptions, JsCompilerSettingsOptions};
+
+/// Re-exports for the Criterion benches under `benches/`. Not part of the public API; hidden so
+/// the hot internal paths stay benchmarkable without widening the documented surface.
+#[doc(hidden)]
+pub mod bench_support {
+  pub use crate::ast::error::AstError;
+  pub use crate::ast::stitcher::stitch_fragment_nodes_into_contract;
+  pub use crate::ast::utils::max_id;
+  pub use crate::compiler::output::into_js_compile_output;
+  pub use foundry_compilers::artifacts::CompilerOutput as StandardCompilerOutput;
+}
@@ -56,6 +56,7 @@ export declare class CompileOutput<
     : undefined;
   get diagnostics(): Array<CompilerError>;
   hasCompilerErrors(): this is CompileOutput<true, TSourcePaths>;
+  materialize(): CompileOutputJson;
   toJson(): CompileOutputJson;
 }
 
@@ -178,6 +179,10 @@ export interface Contract<
   readonly address: FieldValue<Map, "address">;
   readonly creationBytecode: FieldValue<Map, "creationBytecode">;
   readonly deployedBytecode: FieldValue<Map, "deployedBytecode">;
+  /** Creation bytecode as a `Buffer` sharing the native byte store (no hex round-trip). */
+  readonly bytecodeBuffer: Uint8Array | undefined;
+  /** Deployed bytecode as a `Buffer` sharing the native byte store. */
+  readonly deployedBytecodeBuffer: Uint8Array | undefined;
   readonly abi: FieldValue<Map, "abi">;
   readonly metadata: FieldValue<Map, "metadata">;
   readonly userdoc: FieldValue<Map, "userdoc">;
@@ -0,0 +1,55 @@
+/**
+ * Typings for the WASI worker-pool front end (`wasi-pool.mjs`).
+ *
+ * The pool compiles the wasm binary once, shares the compiled `WebAssembly.Module` across N
+ * host workers, and routes concurrent calls to idle members through a FIFO queue. Results are
+ * plain `CompileOutputJson` snapshots rather than live class handles: handles are bound to the
+ * wasm instance that produced them and cannot cross the structured-clone boundary.
+ */
+
+import type { CompileOutputJson, CompilerConfigOptions } from "./index";
+
+export interface CompilerPoolOptions {
+	/**
+	 * Number of wasm workers to spawn. Defaults to one fewer than the reported hardware
+	 * concurrency so the pool leaves a core for the caller's own thread.
+	 */
+	size?: number;
+	/**
+	 * Options used to construct the `Compiler` instance inside every pool member. Per-call
+	 * options passed to `compileSource`/`compileSources` still override these, mirroring the
+	 * native bindings.
+	 */
+	compilerOptions?: CompilerConfigOptions;
+}
+
+export interface CompilerPool {
+	/** Number of workers in the pool. */
+	readonly size: number;
+	/**
+	 * Compile inline source text or an in-memory Solidity AST on the first idle worker.
+	 * Queued when every worker is busy; resolves with the serialisable output snapshot.
+	 */
+	compileSource(
+		target: string | object,
+		options?: CompilerConfigOptions,
+	): Promise<CompileOutputJson>;
+	/** Multi-source counterpart of `compileSource`, also routed to the first idle worker. */
+	compileSources(
+		sources: Record<string, string | object>,
+		options?: CompilerConfigOptions,
+	): Promise<CompileOutputJson>;
+	/**
+	 * Reject queued and in-flight work, then terminate every worker. The pool cannot be
+	 * reused afterwards.
+	 */
+	destroy(): Promise<void>;
+}
+
+/**
+ * Spawn a pool of wasm compiler workers sharing one compiled `WebAssembly.Module`. Resolves
+ * once every member has instantiated and constructed its `Compiler`.
+ */
+export declare function createCompilerPool(
+	options?: CompilerPoolOptions,
+): Promise<CompilerPool>;
@@ -338,10 +338,43 @@ describe('injectShadowAtEdges', () => {
 		expect(requireCallMatcher(statements[4])).toBe(true)
 	})
 
+	test('reuses a compiled shadow template across injections', () => {
+		const ast = new Ast({ solcVersion: DEFAULT_SOLC_VERSION }).fromSource(INLINE_SOURCE)
+		const template = ast.compileShadowTemplate({
+			before: 'uint256 __checkpoint = stored;',
+			after: 'require(stored >= __checkpoint);',
+		})
+		const instrumented = ast.injectShadowAtEdges('get()', { template }).validate()
+
+		const fn = findFunction(instrumented.sourceUnit(), 'InlineExample', 'get')
+		expect(fn).toBeDefined()
+		const statements = fn?.body?.statements ?? []
+		expect(statements).toHaveLength(4)
+		expect(statements[0]).toMatchObject({
+			nodeType: 'VariableDeclarationStatement',
+			declarations: [expect.objectContaining({ name: '__checkpoint' })],
+		})
+		expect(requireCallMatcher(statements[1])).toBe(true)
+		expect(statements[2]?.nodeType).toBe('Return')
+		expect(requireCallMatcher(statements[3])).toBe(true)
+	})
+
+	test('rejects mixing a template with inline snippets', () => {
+		const ast = new Ast({ solcVersion: DEFAULT_SOLC_VERSION }).fromSource(INLINE_SOURCE)
+		const template = ast.compileShadowTemplate({ before: 'uint256 __checkpoint = stored;' })
+		expect(() =>
+			ast.injectShadowAtEdges('get()', { template, before: 'uint256 __other = stored;' }),
+		).toThrowErrorMatchingInlineSnapshot(
+			`"injectShadowAtEdges accepts either a prebuilt \`template\` or \`before\`/\`after\` snippets, not both."`,
+		)
+	})
+
 	test('throws when snippets are missing', () => {
 		expect(() =>
 			new Ast({ solcVersion: DEFAULT_SOLC_VERSION }).fromSource(INLINE_SOURCE).injectShadowAtEdges('get()', {}),
-		).toThrowErrorMatchingInlineSnapshot(`"injectShadowAtEdges requires a \`before\` and/or \`after\` snippet."`)
+		).toThrowErrorMatchingInlineSnapshot(
+			`"injectShadowAtEdges requires a \`before\`/\`after\` snippet or a prebuilt \`template\`."`,
+		)
 	})
 
 	test('throws when selector is ambiguous', () => {
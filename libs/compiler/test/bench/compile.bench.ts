@@ -0,0 +1,85 @@
+/**
+ * JS-side latency benchmarks for the binding's end-to-end paths. Each benchmark warms up, then
+ * reports the median of the measured runs and compares it against the budget committed in
+ * `baselines.json` — the process exits non-zero when a budget is exceeded so CI catches
+ * regressions. Run with `pnpm nx run compiler:bench:js` (or `bun run test/bench/compile.bench.ts`).
+ *
+ * Requires an installed solc toolchain; benchmarks that cannot compile are reported as skipped so
+ * the harness stays usable on sandboxed runners.
+ */
+import { readFileSync } from 'node:fs'
+import { join } from 'node:path'
+import { Ast, Compiler } from '../../build/index.js'
+
+const FIXTURES_DIR = join(__dirname, '..', 'fixtures')
+const COUNTER_SOURCE = readFileSync(join(FIXTURES_DIR, 'contracts', 'Counter.sol'), 'utf8')
+const MULTI_CONTRACT_PATH = join(FIXTURES_DIR, 'contracts', 'MultiContract.sol')
+
+const WARMUP_RUNS = 2
+const MEASURED_RUNS = 7
+
+const baselines = JSON.parse(readFileSync(join(__dirname, 'baselines.json'), 'utf8')) as {
+	budgets: Record<string, number>
+}
+
+type BenchResult = { name: string; medianMs: number; budgetMs: number; pass: boolean }
+
+const results: BenchResult[] = []
+const skipped: string[] = []
+
+const median = (samples: number[]): number => {
+	const sorted = [...samples].sort((a, b) => a - b)
+	return sorted[Math.floor(sorted.length / 2)]
+}
+
+const bench = (name: string, run: () => void) => {
+	const budgetMs = baselines.budgets[name]
+	if (budgetMs === undefined) throw new Error(`No budget for benchmark '${name}' in baselines.json`)
+	try {
+		for (let i = 0; i < WARMUP_RUNS; i++) run()
+	} catch (error) {
+		skipped.push(`${name} (${error instanceof Error ? error.message.split('\n')[0] : String(error)})`)
+		return
+	}
+	const samples: number[] = []
+	for (let i = 0; i < MEASURED_RUNS; i++) {
+		const start = performance.now()
+		run()
+		samples.push(performance.now() - start)
+	}
+	const medianMs = median(samples)
+	results.push({ name, medianMs, budgetMs, pass: medianMs <= budgetMs })
+}
+
+const uncached = new Compiler({ cacheEnabled: false })
+bench('compileSource/counter', () => {
+	const output = uncached.compileSource(COUNTER_SOURCE)
+	if (!output.success) throw new Error(output.errors?.[0]?.message ?? 'compilation failed')
+})
+
+const cached = new Compiler({ cacheEnabled: true })
+bench('compileSource/counter-cached', () => {
+	const output = cached.compileSource(COUNTER_SOURCE)
+	if (!output.success) throw new Error(output.errors?.[0]?.message ?? 'compilation failed')
+})
+
+bench('compileFiles/multi-contract', () => {
+	const output = uncached.compileFiles([MULTI_CONTRACT_PATH])
+	if (!output.success) throw new Error(output.errors?.[0]?.message ?? 'compilation failed')
+})
+
+bench('astParse/counter', () => {
+	new Ast().fromSource(COUNTER_SOURCE).sourceUnit()
+})
+
+for (const { name, medianMs, budgetMs, pass } of results) {
+	console.log(`${pass ? 'PASS' : 'FAIL'} ${name}: median ${medianMs.toFixed(1)}ms (budget ${budgetMs}ms)`)
+}
+for (const name of skipped) {
+	console.log(`SKIP ${name}`)
+}
+
+if (results.some((result) => !result.pass)) {
+	console.error('Benchmark budget exceeded — investigate before merging, or adjust baselines.json deliberately.')
+	process.exit(1)
+}
@@ -1,5 +1,5 @@
 import { afterAll, describe, expect, test } from 'bun:test'
-import { cpSync, mkdirSync, mkdtempSync, realpathSync, rmSync } from 'node:fs'
+import { cpSync, mkdirSync, mkdtempSync, readFileSync, realpathSync, rmSync, writeFileSync } from 'node:fs'
 import { tmpdir } from 'node:os'
 import { basename, join } from 'node:path'
 import { Compiler } from '../build/index.js'
@@ -83,6 +83,39 @@ describe('Compiler.fromFoundryRoot', () => {
 		expect(output.hasCompilerErrors()).toBe(false)
 	})
 
+	test('warm compileProject is served from the source index across instances', () => {
+		const root = cloneFoundryProject()
+		const coldOutput = Compiler.fromFoundryRoot(root).compileProject()
+		expect(contractNames(coldOutput)).toEqual(expect.arrayContaining(['Counter']))
+
+		const warmOutput = Compiler.fromFoundryRoot(root).compileProject()
+		expect(contractNames(warmOutput)).toEqual(contractNames(coldOutput))
+		expect(warmOutput.hasCompilerErrors()).toBe(false)
+
+		const counterPath = join(root, 'src', 'Counter.sol')
+		const original = readFileSync(counterPath, 'utf8')
+		writeFileSync(counterPath, original.replace('contract Counter', 'contract Renamed'))
+
+		const editedOutput = Compiler.fromFoundryRoot(root).compileProject()
+		const names = contractNames(editedOutput)
+		expect(names).toContain('Renamed')
+		expect(names).not.toContain('Counter')
+	})
+
+	test('compileProjectStream yields contract entries before resolving', async () => {
+		const root = cloneFoundryProject()
+		const compiler = Compiler.fromFoundryRoot(root)
+		const entries: { path: string; contractName: string }[] = []
+
+		const errors = await compiler.compileProjectStream((entry) => {
+			entries.push({ path: entry.path, contractName: entry.contractName })
+			expect(entry.contract.name).toBe(entry.contractName)
+		})
+
+		expect(entries.map((entry) => entry.contractName)).toEqual(expect.arrayContaining(['Counter']))
+		expect(errors.every((error) => error.severity !== 'error')).toBe(true)
+	})
+
 	test('compileContract resolves a single counter artifact', () => {
 		const root = cloneFoundryProject()
 		const compiler = Compiler.fromFoundryRoot(root)
@@ -136,6 +169,25 @@ describe('Compiler.fromFoundryRoot', () => {
 		expect(() => compiler.compileContract('MissingContract')).toThrow(/no contract found/i)
 	})
 
+	test('watcher recompiles only the dirty closure on poll', () => {
+		const root = cloneFoundryProject()
+		const compiler = Compiler.fromFoundryRoot(root)
+		const watcher = compiler.createWatcher()
+
+		expect(watcher.watchedPaths.some((path) => path.endsWith('Counter.sol'))).toBe(true)
+		expect(watcher.poll()).toBeNull()
+
+		const counterPath = watcher.watchedPaths.find((path) => path.endsWith('Counter.sol'))
+		if (!counterPath) throw new Error('Counter.sol not watched')
+		const original = readFileSync(counterPath, 'utf8')
+		writeFileSync(counterPath, original.replace('contract Counter', 'contract Counter /* touched */'))
+
+		const output = watcher.poll()
+		expect(output).not.toBeNull()
+		expect(contractNames(output as ArtifactCarrier)).toEqual(expect.arrayContaining(['Counter']))
+		expect(watcher.poll()).toBeNull()
+	})
+
 	test('exposes foundry project paths', () => {
 		const root = cloneFoundryProject()
 		for (const dir of ['src', 'test', 'script', 'lib', 'cache']) {
@@ -245,6 +245,33 @@ describe('Compiler constructor', () => {
 	})
 })
 
+describe('Compiler.compileMatrix', () => {
+	test('compiles one source across several solc versions', async () => {
+		await Compiler.installSolcVersion(ALT_SOLC_VERSION)
+		const compiler = new Compiler({ cacheEnabled: false })
+		const outputs = compiler.compileMatrix(INLINE_SOURCE, [DEFAULT_SOLC_VERSION, ALT_SOLC_VERSION])
+
+		expect(Object.keys(outputs).sort()).toEqual([DEFAULT_SOLC_VERSION, ALT_SOLC_VERSION].sort())
+		for (const version of [DEFAULT_SOLC_VERSION, ALT_SOLC_VERSION]) {
+			const output = outputs[version]
+			expect(output.hasCompilerErrors()).toBe(false)
+			expect(flattenContracts(output).map((contract) => contract.name)).toEqual(
+				expect.arrayContaining(['InlineExample']),
+			)
+		}
+	})
+
+	test('rejects malformed version strings', () => {
+		const compiler = new Compiler({ cacheEnabled: false })
+		expect(() => compiler.compileMatrix(INLINE_SOURCE, ['not-a-version'])).toThrow(/invalid solc version/i)
+	})
+
+	test('requires at least one version', () => {
+		const compiler = new Compiler({ cacheEnabled: false })
+		expect(() => compiler.compileMatrix(INLINE_SOURCE, [])).toThrow(/at least one solc version/i)
+	})
+})
+
 describe('Compiler.compileSource with Solidity strings', () => {
 	test('compiles inline solidity and exposes artifacts', () => {
 		const compiler = new Compiler({ cacheEnabled: false })
@@ -323,6 +350,22 @@ describe('Compiler.compileSource with Solidity strings', () => {
 		expect(Object.keys(parsingOnlyCorrect.artifact?.contracts ?? {})).toHaveLength(0)
 	})
 
+	test('outputs fast mode omits unrequested sections', () => {
+		const compiler = new Compiler({ cacheEnabled: false })
+		const output = compiler.compileSource(INLINE_SOURCE, { outputs: ['bytecode'] })
+
+		expect(output.hasCompilerErrors()).toBe(false)
+		const [contract] = flattenContracts(output)
+		expect(contract.creationBytecode?.length ?? 0).toBeGreaterThan(0)
+		expect(contract.abi ?? undefined).toBeUndefined()
+		expect(contract.metadata ?? undefined).toBeUndefined()
+		expect(output.artifact?.ast).toBeUndefined()
+
+		expect(() => compiler.compileSource(INLINE_SOURCE, { outputs: ['evm.bytecode' as never] })).toThrow(
+			/Unknown output selector/,
+		)
+	})
+
 	test('accepts complete solcSettings payload', () => {
 		const settings = {
 			stopAfter: 'parsing',
@@ -504,6 +547,18 @@ describe('Compiler.compileSources', () => {
 		expect(names).toEqual(expect.arrayContaining(['InlineExample', 'WarningContract']))
 	})
 
+	test('compiles disjoint entries in parallel shards', () => {
+		const compiler = new Compiler({ cacheEnabled: false, maxParallelJobs: 2 })
+		const output = compiler.compileSources({
+			'InlineExample.sol': INLINE_SOURCE,
+			'WarningContract.sol': WARNING_SOURCE,
+		})
+
+		expect(output.hasCompilerErrors()).toBe(false)
+		const names = flattenContracts(output).map((contract) => contract.name)
+		expect(names).toEqual(expect.arrayContaining(['InlineExample', 'WarningContract']))
+	})
+
 	test('compiles Yul sources when supplied as a map', () => {
 		const compiler = new Compiler({ cacheEnabled: false })
 		const output = compiler.compileSources(
@@ -550,6 +605,102 @@ describe('Compiler.compileSources', () => {
 	})
 })
 
+describe('Compiler async compile APIs', () => {
+	test('compileSourceAsync resolves with the same snapshot as compileSource', async () => {
+		const compiler = new Compiler({ cacheEnabled: false })
+		const output = await compiler.compileSourceAsync(INLINE_SOURCE)
+
+		expect(output.hasCompilerErrors()).toBe(false)
+		const [contract] = flattenContracts(output)
+		expect(contract.name).toBe('InlineExample')
+	})
+
+	test('compileSourcesAsync compiles entries concurrently', async () => {
+		const compiler = new Compiler({ cacheEnabled: false })
+		const [first, second] = await Promise.all([
+			compiler.compileSourcesAsync({ 'InlineExample.sol': INLINE_SOURCE }),
+			compiler.compileSourcesAsync({ 'WarningContract.sol': WARNING_SOURCE }),
+		])
+
+		expect(flattenContracts(first).map((contract) => contract.name)).toContain('InlineExample')
+		expect(flattenContracts(second).map((contract) => contract.name)).toContain('WarningContract')
+	})
+
+	test('compileFilesAsync rejects with compiler diagnostics intact', async () => {
+		const compiler = new Compiler({ cacheEnabled: false })
+		const output = await compiler.compileFilesAsync([BROKEN_PATH])
+		expect(output.hasCompilerErrors()).toBe(true)
+	})
+
+	test('compileSourceAsync validates options before queueing work', () => {
+		const compiler = new Compiler({ cacheEnabled: false })
+		expect(() => compiler.compileSourceAsync(INLINE_SOURCE, { solcVersion: 'not-a-version' })).toThrow(
+			'Failed to parse solc version',
+		)
+	})
+})
+
+describe('Compiler compile cache', () => {
+	test('repeated identical compiles are answered from the in-memory cache', () => {
+		const compiler = new Compiler()
+		compiler.clearCache()
+		const before = compiler.getCacheStats()
+
+		const first = compiler.compileSource(INLINE_SOURCE)
+		const second = compiler.compileSource(INLINE_SOURCE)
+
+		const after = compiler.getCacheStats()
+		expect(after.misses).toBeGreaterThan(before.misses)
+		expect(after.hits).toBe(before.hits + 1)
+		expect(after.entries).toBeGreaterThan(0)
+		expect(second.toJson()).toEqual(first.toJson())
+	})
+
+	test('cacheEnabled: false bypasses the in-memory cache', () => {
+		const compiler = new Compiler({ cacheEnabled: false })
+		const before = compiler.getCacheStats()
+		compiler.compileSource(INLINE_SOURCE)
+		compiler.compileSource(INLINE_SOURCE)
+		const after = compiler.getCacheStats()
+		expect(after.hits).toBe(before.hits)
+	})
+
+	test('invalidateResolutionCache is callable without an attached project', () => {
+		const compiler = new Compiler()
+		expect(compiler.invalidateResolutionCache()).toBeUndefined()
+	})
+})
+
+describe('Compiler.getMetrics', () => {
+	test('accumulates phase timings across compiles', () => {
+		const compiler = new Compiler({ cacheEnabled: false })
+		const before = compiler.getMetrics()
+		compiler.compileSource(INLINE_SOURCE)
+		const after = compiler.getMetrics()
+
+		for (const phase of ['projectResolution', 'solcExecution', 'jsonParse', 'outputConversion', 'astOperation']) {
+			expect(after.phases[phase]).toBeDefined()
+		}
+		expect(after.phases.solcExecution.calls).toBeGreaterThan(before.phases.solcExecution.calls)
+		expect(after.phases.solcExecution.totalMs).toBeGreaterThan(0)
+		expect(after.phases.jsonParse.calls).toBeGreaterThan(before.phases.jsonParse.calls)
+		expect(after.phases.outputConversion.calls).toBeGreaterThan(before.phases.outputConversion.calls)
+	})
+
+	test('reports cache hit rates per tier', () => {
+		const compiler = new Compiler()
+		compiler.clearCache()
+		compiler.compileSource(INLINE_SOURCE)
+		compiler.compileSource(INLINE_SOURCE)
+
+		const metrics = compiler.getMetrics()
+		expect(metrics.memoryCache.hits).toBeGreaterThan(0)
+		expect(metrics.memoryCache.hitRate).toBeGreaterThan(0)
+		expect(metrics.memoryCache.hitRate).toBeLessThanOrEqual(1)
+		expect(metrics.diskCache.hits + metrics.diskCache.misses).toBeGreaterThanOrEqual(0)
+	})
+})
+
 describe('Compiler toJson snapshots', () => {
 	test('captures structured Solidity artifacts', () => {
 		const compiler = new Compiler({ cacheEnabled: false })
@@ -559,6 +710,16 @@ describe('Compiler toJson snapshots', () => {
 		expect(output.toJson()).toMatchSnapshot()
 	})
 
+	test('materialize matches toJson and resolves lazy artifact handles', () => {
+		const compiler = new Compiler({ cacheEnabled: false })
+		const output = compiler.compileSource(INLINE_SOURCE)
+
+		const snapshot = output.materialize()
+		expect(snapshot.artifact?.contracts).toBeDefined()
+		expect(snapshot).toEqual(output.toJson())
+		expect(output.artifact?.toJson()).toEqual(snapshot.artifact)
+	})
+
 	test('captures structured Yul artifacts', () => {
 		const compiler = new Compiler({ cacheEnabled: false })
 		const output = compiler.compileSources(
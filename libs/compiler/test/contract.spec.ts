@@ -99,6 +99,16 @@ describe('Contract', () => {
 		expect(snapshot.deployedBytecode?.hex).toBe('0xcafe')
 	})
 
+	test('buffer getters expose raw bytecode bytes', () => {
+		const contract = new Contract({ name: 'Buffers' })
+			.withCreationBytecode(Buffer.from([0xde, 0xad]))
+			.withDeployedBytecode(Buffer.from([0xca, 0xfe]))
+
+		expect(Array.from(contract.bytecodeBuffer ?? [])).toEqual([0xde, 0xad])
+		expect(Array.from(contract.deployedBytecodeBuffer ?? [])).toEqual([0xca, 0xfe])
+		expect(new Contract({ name: 'Empty' }).bytecodeBuffer).toBeUndefined()
+	})
+
 	test('hex string bytecode is accepted', () => {
 		const creationHex = '0xDEADBEEF'
 		const deployedHex = '0xFEEDFACE'